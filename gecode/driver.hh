@@ -329,6 +329,7 @@ namespace Gecode {
     Driver::DoubleOption      _threads;   ///< How many threads to use
     Driver::UnsignedIntOption _c_d;       ///< Copy recomputation distance
     Driver::UnsignedIntOption _a_d;       ///< Adaptive recomputation distance
+    Driver::BoolOption        _trail;     ///< Whether to use trailing
     Driver::UnsignedIntOption _node;      ///< Cutoff for number of nodes
     Driver::UnsignedIntOption _fail;      ///< Cutoff for number of failures
     Driver::UnsignedIntOption _time;      ///< Cutoff for time
@@ -341,6 +342,10 @@ namespace Gecode {
     Driver::UnsignedIntOption _samples;    ///< How many samples
     Driver::UnsignedIntOption _iterations; ///< How many iterations per sample
     Driver::BoolOption        _print_last; ///< Print only last solution found
+    Driver::StringOption      _chunks;     ///< How to allocate memory chunks
+    Driver::BoolOption        _prefault;   ///< Whether to prefault memory chunks
+    Driver::BoolOption        _adaptive;   ///< Whether to schedule by observed cost
+    Driver::UnsignedIntOption _propagation_threads; ///< Threads for propagation
     Driver::StringValueOption _out_file;   ///< Where to print solutions
     Driver::StringValueOption _log_file;   ///< Where to print statistics
     //@}
@@ -414,6 +419,11 @@ namespace Gecode {
     /// Return adaptive recomputation distance
     unsigned int a_d(void) const;
     
+    /// Set default whether depth-first search uses trailing
+    void trail(bool b);
+    /// Return whether depth-first search uses trailing
+    bool trail(void) const;
+    
     /// Set default node cutoff
     void node(unsigned int n);
     /// Return node cutoff
@@ -457,6 +467,26 @@ namespace Gecode {
     /// Return whether to print only last solution found
     bool print_last(void) const;
 
+    /// Set default for how memory chunks for spaces are allocated
+    void chunks(Heap::ChunkMode cm);
+    /// Return how memory chunks for spaces are allocated
+    Heap::ChunkMode chunks(void) const;
+
+    /// Set default whether to prefault mapped memory chunks
+    void prefault(bool b);
+    /// Return whether to prefault mapped memory chunks
+    bool prefault(void) const;
+
+    /// Set default whether propagators are scheduled by observed cost
+    void adaptive(bool b);
+    /// Return whether propagators are scheduled by observed cost
+    bool adaptive(void) const;
+
+    /// Set default number of threads for propagation
+    void propagation_threads(unsigned int n);
+    /// Return number of threads for propagation
+    unsigned int propagation_threads(void) const;
+
     /// Set default output file name for solutions
     void out_file(const char* f);
     /// Get file name for solutions
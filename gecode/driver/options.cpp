@@ -371,6 +371,7 @@ namespace Gecode {
                Search::Config::threads),
       _c_d("-c-d","recomputation commit distance",Search::Config::c_d),
       _a_d("-a-d","recomputation adaptation distance",Search::Config::a_d),
+      _trail("-trail","whether depth-first search uses trailing",false),
       _node("-node","node cutoff (0 = none, solution mode)"),
       _fail("-fail","failure cutoff (0 = none, solution mode)"),
       _time("-time","time (in ms) cutoff (0 = none, solution mode)"),
@@ -383,6 +384,14 @@ namespace Gecode {
       _print_last("-print-last",
                   "whether to only print the last solution (solution mode)",
                   false),
+      _chunks("-chunks","how to allocate memory chunks for spaces",
+              Heap::CM_MALLOC),
+      _prefault("-prefault","whether to prefault mapped memory chunks",
+                false),
+      _adaptive("-adaptive","whether propagators are scheduled by observed cost",
+                false),
+      _propagation_threads("-propagation-threads",
+                           "number of threads for propagation",1),
       _out_file("-file-sol", "where to print solutions "
                 "(supports stdout, stdlog, stderr)","stdout"),
       _log_file("-file-stat", "where to print statistics "
@@ -396,12 +405,19 @@ namespace Gecode {
     _mode.add(SM_TIME, "time");
     _mode.add(SM_STAT, "stat");
     _mode.add(SM_GIST, "gist");
+
+    _chunks.add(Heap::CM_MALLOC, "malloc");
+    _chunks.add(Heap::CM_MMAP, "mmap");
+    _chunks.add(Heap::CM_THP, "thp", "transparent huge pages");
+    _chunks.add(Heap::CM_HUGE, "huge", "reserved huge pages");
     
     add(_model); add(_symmetry); add(_propagation); add(_icl); 
     add(_branching);
     add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
+    add(_trail);
     add(_node); add(_fail); add(_time); add(_interrupt);
     add(_mode); add(_iterations); add(_samples); add(_print_last);
+    add(_chunks); add(_prefault); add(_adaptive); add(_propagation_threads);
     add(_out_file); add(_log_file);
   }
 
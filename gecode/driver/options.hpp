@@ -265,6 +265,15 @@ namespace Gecode {
     return _a_d.value();
   }
   
+  inline void
+  Options::trail(bool b) {
+    _trail.value(b);
+  }
+  inline bool
+  Options::trail(void) const {
+    return _trail.value();
+  }
+  
   inline void
   Options::node(unsigned int n) {
     _node.value(n);
@@ -342,6 +351,42 @@ namespace Gecode {
     return _print_last.value();
   }
 
+  inline void
+  Options::chunks(Heap::ChunkMode cm) {
+    _chunks.value(cm);
+  }
+  inline Heap::ChunkMode
+  Options::chunks(void) const {
+    return static_cast<Heap::ChunkMode>(_chunks.value());
+  }
+
+  inline void
+  Options::prefault(bool b) {
+    _prefault.value(b);
+  }
+  inline bool
+  Options::prefault(void) const {
+    return _prefault.value();
+  }
+
+  inline void
+  Options::adaptive(bool b) {
+    _adaptive.value(b);
+  }
+  inline bool
+  Options::adaptive(void) const {
+    return _adaptive.value();
+  }
+
+  inline void
+  Options::propagation_threads(unsigned int n) {
+    _propagation_threads.value(n);
+  }
+  inline unsigned int
+  Options::propagation_threads(void) const {
+    return _propagation_threads.value();
+  }
+
   inline void
   Options::out_file(const char *f) {
     _out_file.value(f);
@@ -40,6 +40,10 @@
 
 #include <cmath>
 
+#ifdef GECODE_HAS_UNISTD_H
+#include <sys/resource.h>
+#endif
+
 namespace Gecode { namespace Driver {
     
   void 
@@ -97,6 +101,29 @@ namespace Gecode { namespace Driver {
     return ::sqrt(s / (n-1)) / m;
   }
 
+  double
+  clonetime(const Space& s) {
+    Support::Timer t;
+    t.start();
+    delete s.clone(false);
+    return t.stop();
+  }
+
+  unsigned long int
+  peakrss(void) {
+#ifdef GECODE_HAS_UNISTD_H
+    struct rusage ru;
+    if (::getrusage(RUSAGE_SELF, &ru) == 0)
+#ifdef __APPLE__
+      // Reported in bytes rather than kilobytes
+      return static_cast<unsigned long int>(ru.ru_maxrss) / 1024;
+#else
+      return static_cast<unsigned long int>(ru.ru_maxrss);
+#endif
+#endif
+    return 0;
+  }
+
   bool Cutoff::sigint;
 
 }}
@@ -150,6 +150,20 @@ namespace Gecode { namespace Driver {
    */
   GECODE_DRIVER_EXPORT double
   dev(double t[], int n);
+
+  /**
+   * \brief Return time (in milliseconds) for cloning space \a s
+   */
+  GECODE_DRIVER_EXPORT double
+  clonetime(const Space& s);
+
+  /**
+   * \brief Return peak resident set size of the process (in KB)
+   *
+   * Returns zero if the platform does not support it.
+   */
+  GECODE_DRIVER_EXPORT unsigned long int
+  peakrss(void);
   
 #ifdef GECODE_HAS_GIST
   
@@ -187,6 +201,15 @@ namespace Gecode { namespace Driver {
     }
   };
   
+  /// Specialization for LDS
+  template<typename S>
+  class GistEngine<LDS<S> > {
+  public:
+    static void explore(S* root, const Gist::Options& opt) {
+      (void) Gist::dfs(root, opt);
+    }
+  };
+  
 #endif
 
 
@@ -217,6 +240,9 @@ namespace Gecode { namespace Driver {
     ostream& s_out = select_ostream(o.out_file(), sol_file);
     ostream& l_out = select_ostream(o.log_file(), log_file);
 
+    Gecode::heap.chunk_mode(o.chunks(), o.prefault());
+    Gecode::Space::parallel_default(o.propagation_threads());
+
     try {
       switch (o.mode()) {
       case SM_GIST:
@@ -240,6 +266,7 @@ namespace Gecode { namespace Driver {
             opt.inspect.compare(o.inspect.compare(i));
           if (s == NULL)
             s = new Script(o);
+          s->adaptive(o.adaptive());
           (void) GistEngine<Engine<Script> >::explore(s, opt);
         }
         break;
@@ -253,18 +280,23 @@ namespace Gecode { namespace Driver {
           t.start();
           if (s == NULL)
             s = new Script(o);
+          s->adaptive(o.adaptive());
           unsigned int n_p = s->propagators();
           unsigned int n_b = s->branchers();
+          unsigned long int n_i = s->identical_removed();
           Search::Options so;
           so.threads = o.threads();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.trail   = o.trail();
           so.stop    = Cutoff::create(o.node(),o.fail(), o.time(), 
                                       o.interrupt());
           so.clone   = false;
           if (o.interrupt())
             Cutoff::installCtrlHandler(true);
           Engine<Script> e(s,so);
+          // Time for cloning the first solution (negative if none)
+          double ct = -1.0;
           if (o.print_last()) {
             Script* px = NULL;
             do {
@@ -276,6 +308,8 @@ namespace Gecode { namespace Driver {
                 }
                 break;
               } else {
+                if (ct < 0.0)
+                  ct = clonetime(*ex);
                 delete px;
                 px = ex;
               }
@@ -285,6 +319,8 @@ namespace Gecode { namespace Driver {
               Script* ex = e.next();
               if (ex == NULL)
                 break;
+              if (ct < 0.0)
+                ct = clonetime(*ex);
               ex->print(s_out);
               delete ex;
             } while (--i != 0);
@@ -311,8 +347,10 @@ namespace Gecode { namespace Driver {
           }
           l_out << "Initial" << endl
                 << "\tpropagators: " << n_p << endl
-                << "\tbranchers:   " << n_b << endl
-                << endl
+                << "\tbranchers:   " << n_b << endl;
+          if (n_i > 0)
+            l_out << "\tidentical:   " << n_i << endl;
+          l_out << endl
                 << "Summary" << endl
                 << "\truntime:      ";
           stop(t, l_out);
@@ -325,7 +363,12 @@ namespace Gecode { namespace Driver {
                 << "\tpeak depth:   " << stat.depth << endl
                 << "\tpeak memory:  "
                 << static_cast<int>((stat.memory+1023) / 1024) << " KB"
-                << endl;
+                << endl
+                << "\theap chunks:  " << stat.hc_alloc << " allocated, "
+                << stat.hc_reuse << " recycled" << endl;
+          if (ct >= 0.0)
+            l_out << "\tclone time:   " << ct << " ms" << endl;
+          l_out << "\tpeak RSS:     " << peakrss() << " KB" << endl;
           delete so.stop;
         }
         break;
@@ -337,30 +380,39 @@ namespace Gecode { namespace Driver {
           t.start();
           if (s == NULL)
             s = new Script(o);
+          s->adaptive(o.adaptive());
           unsigned int n_p = s->propagators();
           unsigned int n_b = s->branchers();
+          unsigned long int n_i = s->identical_removed();
           Search::Options so;
           so.clone   = false;
           so.threads = o.threads();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.trail   = o.trail();
           so.stop    = Cutoff::create(o.node(),o.fail(), o.time(),
                                       o.interrupt());
           if (o.interrupt())
             Cutoff::installCtrlHandler(true);
           Engine<Script> e(s,so);
+          // Time for cloning the first solution (negative if none)
+          double ct = -1.0;
           do {
             Script* ex = e.next();
             if (ex == NULL)
               break;
+            if (ct < 0.0)
+              ct = clonetime(*ex);
             delete ex;
           } while (--i != 0);
           if (o.interrupt())
             Cutoff::installCtrlHandler(false);
           Search::Statistics stat = e.statistics();
           l_out << endl
-               << "\tpropagators:  " << n_p << endl
-               << "\tbranchers:    " << n_b << endl
+               << "\tpropagators:  " << n_p << endl;
+          if (n_i > 0)
+            l_out << "\tidentical:    " << n_i << endl;
+          l_out << "\tbranchers:    " << n_b << endl
                << "\truntime:      ";
           stop(t, l_out);
           l_out << endl
@@ -372,7 +424,12 @@ namespace Gecode { namespace Driver {
                << "\tpeak depth:   " << stat.depth << endl
                << "\tpeak memory:  "
                << static_cast<int>((stat.memory+1023) / 1024) << " KB"
-               << endl;
+               << endl
+               << "\theap chunks:  " << stat.hc_alloc << " allocated, "
+               << stat.hc_reuse << " recycled" << endl;
+          if (ct >= 0.0)
+            l_out << "\tclone time:   " << ct << " ms" << endl;
+          l_out << "\tpeak RSS:     " << peakrss() << " KB" << endl;
         }
         break;
       case SM_TIME:
@@ -386,11 +443,13 @@ namespace Gecode { namespace Driver {
             for (unsigned int k = o.iterations(); !stopped && k--; ) {
               unsigned int i = o.solutions();
               Script* s = new Script(o);
+              s->adaptive(o.adaptive());
               Search::Options so;
               so.clone   = false;
               so.threads = o.threads();
               so.c_d     = o.c_d();
               so.a_d     = o.a_d();
+              so.trail   = o.trail();
               so.stop    = Cutoff::create(o.node(),o.fail(), o.time(), false);
               Engine<Script> e(s,so);
               do {
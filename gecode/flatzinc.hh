@@ -217,6 +217,7 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::UnsignedIntOption _fail;      ///< Cutoff for number of failures
       Gecode::Driver::UnsignedIntOption _time;      ///< Cutoff for time
       Gecode::Driver::IntOption         _seed;      ///< Random seed
+      Gecode::Driver::BoolOption        _identical; ///< Omit identical propagators
       //@}
     
       /// \name Execution options
@@ -245,6 +246,7 @@ namespace Gecode { namespace FlatZinc {
       _fail("-fail","failure cutoff (0 = none, solution mode)"),
       _time("-time","time (in ms) cutoff (0 = none, solution mode)"),
       _seed("-r","random seed",0),
+      _identical("-identical","omit identical propagators",false),
       _mode("-mode","how to execute script",Gecode::SM_SOLUTION),
       _stat("-s","emit statistics"),
       _output("-o","file to send output to") {
@@ -260,6 +262,7 @@ namespace Gecode { namespace FlatZinc {
       add(_search);
       add(_node); add(_fail); add(_time);
       add(_seed);
+      add(_identical);
       add(_mode); add(_stat);
       add(_output);
     }
@@ -293,6 +296,7 @@ namespace Gecode { namespace FlatZinc {
     unsigned int fail(void) const { return _fail.value(); }
     unsigned int time(void) const { return _time.value(); }
     int seed(void) const { return _seed.value(); }
+    bool identical(void) const { return _identical.value(); }
     const char* output(void) const { return _output.value(); }
     Gecode::ScriptMode mode(void) const {
       return static_cast<Gecode::ScriptMode>(_mode.value());
@@ -1064,6 +1064,7 @@ namespace Gecode { namespace FlatZinc {
            << "%%  variables:     " 
            << (intVarCount + boolVarCount + setVarCount) << endl
            << "%%  propagators:   " << n_p << endl
+           << "%%  identical:     " << identical_removed() << endl
            << "%%  propagations:  " << sstat.propagate+stat.propagate << endl
            << "%%  nodes:         " << stat.node << endl
            << "%%  failures:      " << stat.fail << endl
@@ -1345,6 +1345,93 @@ namespace Gecode {
     init(Home, const FloatVarArgs& x, double d);
   };
 
+  /// Recording conflict history based scores for float variables
+  class FloatCHB : public CHB {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized score storage is init or the assignment operator.
+     *
+     */
+    FloatCHB(void);
+    /// Copy constructor
+    FloatCHB(const FloatCHB& a);
+    /// Assignment operator
+    FloatCHB& operator =(const FloatCHB& a);
+    /// Initialize for float variables \a x
+    GECODE_FLOAT_EXPORT
+    FloatCHB(Home home, const FloatVarArgs& x);
+    /**
+     * \brief Initialize for float variables \a x
+     *
+     * This member function can only be used once and only if the
+     * score storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_FLOAT_EXPORT void
+    init(Home home, const FloatVarArgs& x);
+  };
+
+  /// Recording weighted degrees for float variables
+  class FloatWDeg : public WDeg {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized weight storage is init or the assignment operator.
+     *
+     */
+    FloatWDeg(void);
+    /// Copy constructor
+    FloatWDeg(const FloatWDeg& a);
+    /// Assignment operator
+    FloatWDeg& operator =(const FloatWDeg& a);
+    /// Initialize for float variables \a x
+    GECODE_FLOAT_EXPORT
+    FloatWDeg(Home home, const FloatVarArgs& x);
+    /**
+     * \brief Initialize for float variables \a x
+     *
+     * This member function can only be used once and only if the
+     * weight storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_FLOAT_EXPORT void
+    init(Home home, const FloatVarArgs& x);
+  };
+
+  /// Recording phases for float variables
+  class FloatPhase : public Phase {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized phase storage is init or the assignment operator.
+     *
+     */
+    FloatPhase(void);
+    /// Copy constructor
+    FloatPhase(const FloatPhase& a);
+    /// Assignment operator
+    FloatPhase& operator =(const FloatPhase& a);
+    /// Initialize for float variables \a x
+    GECODE_FLOAT_EXPORT
+    FloatPhase(Home home, const FloatVarArgs& x);
+    /**
+     * \brief Initialize for float variables \a x
+     *
+     * This member function can only be used once and only if the
+     * phase storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_FLOAT_EXPORT void
+    init(Home home, const FloatVarArgs& x);
+  };
+
   /// Which variable to select for branching
   enum FloatVarBranch {
     FLOAT_VAR_NONE = 0,        ///< First unassigned
@@ -1355,6 +1442,10 @@ namespace Gecode {
     FLOAT_VAR_AFC_MAX,         ///< With largest accumulated failure count
     FLOAT_VAR_ACTIVITY_MIN,    ///< With lowest activity
     FLOAT_VAR_ACTIVITY_MAX,    ///< With highest activity
+    FLOAT_VAR_CHB_MIN,         ///< With lowest conflict history score
+    FLOAT_VAR_CHB_MAX,         ///< With highest conflict history score
+    FLOAT_VAR_WDEG_MIN,        ///< With smallest weighted degree
+    FLOAT_VAR_WDEG_MAX,        ///< With largest weighted degree
     FLOAT_VAR_MIN_MIN,         ///< With smallest min
     FLOAT_VAR_MIN_MAX,         ///< With largest min
     FLOAT_VAR_MAX_MIN,         ///< With smallest max
@@ -1367,13 +1458,16 @@ namespace Gecode {
     FLOAT_VAR_SIZE_AFC_MAX,    ///< With largest domain size divided by accumulated failure count
     FLOAT_VAR_SIZE_ACTIVITY_MIN, ///< With smallest domain size divided by activity
     FLOAT_VAR_SIZE_ACTIVITY_MAX, ///< With largest domain size divided by activity
+    FLOAT_VAR_SIZE_WDEG_MIN,   ///< With smallest domain size divided by weighted degree
+    FLOAT_VAR_SIZE_WDEG_MAX,   ///< With largest domain size divided by weighted degree
   };
   
   /// Which values to select first for branching
   enum FloatValBranch {
     FLOAT_VAL_SPLIT_MIN, ///< Select values not greater than mean of smallest and largest value
     FLOAT_VAL_SPLIT_MAX, ///< Select values not smaller than mean of largest and smallest value
-    FLOAT_VAL_SPLIT_RND  ///< Select values randomly which are not greater or not smaller than mean of largest and smallest value
+    FLOAT_VAL_SPLIT_RND, ///< Select values randomly which are not greater or not smaller than mean of largest and smallest value
+    FLOAT_VAL_SOLUTION   ///< Select values on the side of the mean containing the value from last solution or failure, otherwise not greater than the mean
   };
   
   /// Branch over \a x with variable selection \a vars and value selection \a vals
@@ -1419,6 +1513,9 @@ namespace Gecode {
 }
 
 #include <gecode/float/activity.hpp>
+#include <gecode/float/chb.hpp>
+#include <gecode/float/wdeg.hpp>
+#include <gecode/float/phase.hpp>
 
 #endif
 
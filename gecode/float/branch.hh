@@ -174,6 +174,52 @@ namespace Gecode { namespace Float { namespace Branch {
     AssignValRnd(Space& home, const ValBranchOptions& vbo);
   };
 
+  /**
+   * \brief %Brancher by view selection and value from last solution
+   *
+   * The brancher first tries for the selected view the part of the
+   * domain containing the value from the last solution found or, if
+   * no solution has been found yet, from the last failure. When the
+   * brancher has no more views to branch on, the values of all views
+   * are recorded as solution phase.
+   *
+   */
+  template<class ViewSel>
+  class ViewPhaseBrancher : public ViewBrancher<ViewSel> {
+  protected:
+    /// The view type
+    typedef typename ViewSel::View View;
+    /// The value type (split point and whether lower part comes first)
+    typedef std::pair<FloatNum,bool> Val;
+    using ViewBrancher<ViewSel>::x;
+    using ViewBrancher<ViewSel>::viewsel;
+    /// Phase information (updated when the brancher is done)
+    mutable Phase phase;
+    /// Constructor for cloning \a b
+    ViewPhaseBrancher(Space& home, bool share, ViewPhaseBrancher& b);
+    /// Constructor for creation
+    ViewPhaseBrancher(Home home, ViewArray<View>& x,
+                      ViewSel& vi_s, const Phase& phase, 
+                      BranchFilter bf);
+  public:
+    /// Check status of brancher, record solution phase if done
+    virtual bool status(const Space& home) const;
+    /// Return choice
+    virtual const Choice* choice(Space& home);
+    /// Return choice
+    virtual const Choice* choice(const Space& home, Archive& e);
+    /// Perform commit for choice \a c and alternative \a a
+    virtual ExecStatus commit(Space& home, const Choice& c, unsigned int a);
+    /// Perform cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Delete brancher and return its size
+    virtual size_t dispose(Space& home);
+    /// Brancher post function
+    static void post(Home home, ViewArray<View>& x,
+                     ViewSel& vi_s, const Phase& phase, 
+                     BranchFilter bf=NULL);
+  };
+
 
   /*
    * Variable selection classes
@@ -450,9 +496,68 @@ namespace Gecode { namespace Float { namespace Branch {
     void dispose(Space& home);
   };
 
+  /**
+   * \brief View selection class for view with smallest size divided by weighted degree
+   *
+   * Requires \code #include <gecode/float/branch.hh> \endcode
+   * \ingroup FuncFloatSelView
+   */
+  class BySizeWDegMin : public ViewSelBase<FloatView> {
+  protected:
+    /// Weighted degree information
+    WDeg wdeg;
+    /// So-far smallest size/weighted degree
+    double sizewdeg;
+  public:
+    /// Default constructor
+    BySizeWDegMin(void);
+    /// Constructor for initialization
+    BySizeWDegMin(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, View x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, View x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, BySizeWDegMin& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
+  /**
+   * \brief View selection class for view with largest size divided by weighted degree
+   *
+   * Requires \code #include <gecode/float/branch.hh> \endcode
+   * \ingroup FuncFloatSelView
+   */
+  class BySizeWDegMax : public ViewSelBase<FloatView> {
+  protected:
+    /// Weighted degree information
+    WDeg wdeg;
+    /// So-far largest size/weighted degree
+    double sizewdeg;
+  public:
+    /// Default constructor
+    BySizeWDegMax(void);
+    /// Constructor for initialization
+    BySizeWDegMax(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, View x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, View x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, BySizeWDegMax& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
 }}}
 
 #include <gecode/float/branch/select-val.hpp>
+#include <gecode/float/branch/select-phase.hpp>
 #include <gecode/float/branch/select-view.hpp>
 #include <gecode/float/branch/post-val-float.hpp>
 
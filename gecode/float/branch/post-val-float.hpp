@@ -39,11 +39,15 @@
 
 namespace Gecode { namespace Float { namespace Branch {
 
-  /// Post brancher according to \a v and \a vals
-  template<class SelView>
+  /// Post brancher according to \a vs, \a vals, and \a o_vars
+  template<class ViewSel>
   void
-  post(Space& home, ViewArray<FloatView>& x, SelView& v,
-       FloatValBranch vals, const ValBranchOptions& o_vals, BranchFilter bf) {
+  post(Space& home, ViewArray<FloatView>& x, ViewSel& vs,
+       FloatValBranch vals, const ValBranchOptions& o_vals,
+       const VarBranchOptions& o_vars) {
+    typedef ViewSelLastConflict<ViewSel> SelView;
+    SelView v(home,vs,o_vars);
+    BranchFilter bf = o_vars.bf;
     switch (vals) {
     case FLOAT_VAL_SPLIT_MIN:
       {
@@ -63,6 +67,13 @@ namespace Gecode { namespace Float { namespace Branch {
         ViewValBrancher<SelView,ValSplitRnd<FloatView> >::post(home,x,v,a,bf);
       }
       break;
+    case FLOAT_VAL_SOLUTION:
+      if (!o_vals.phase.initialized())
+        throw MissingPhase("Float::branch (FLOAT_VAL_SOLUTION)");
+      if (o_vals.phase.size() != x.size())
+        throw PhaseWrongArity("Float::branch");
+      ViewPhaseBrancher<SelView>::post(home,x,v,o_vals.phase,bf);
+      break;
     default:
       throw UnknownBranching("Float::branch");
     }
@@ -0,0 +1,139 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Float { namespace Branch {
+
+  template<class ViewSel>
+  forceinline
+  ViewPhaseBrancher<ViewSel>::
+  ViewPhaseBrancher(Home home, ViewArray<View>& x,
+                    ViewSel& vi_s, const Phase& phase0, BranchFilter bf)
+    : ViewBrancher<ViewSel>(home,x,vi_s,bf), phase(phase0) {
+    if (!viewsel.notice())
+      home.notice(*this,AP_DISPOSE);
+  }
+
+  template<class ViewSel>
+  void
+  ViewPhaseBrancher<ViewSel>::
+  post(Home home, ViewArray<View>& x, ViewSel& vi_s, const Phase& phase,
+       BranchFilter bf) {
+    (void) new (home) ViewPhaseBrancher<ViewSel>(home,x,vi_s,phase,bf);
+  }
+
+  template<class ViewSel>
+  forceinline
+  ViewPhaseBrancher<ViewSel>::
+  ViewPhaseBrancher(Space& home, bool share, ViewPhaseBrancher& b)
+    : ViewBrancher<ViewSel>(home,share,b) {
+    phase.update(home,share,b.phase);
+  }
+
+  template<class ViewSel>
+  Actor*
+  ViewPhaseBrancher<ViewSel>::copy(Space& home, bool share) {
+    return new (home)
+      ViewPhaseBrancher<ViewSel>(home,share,*this);
+  }
+
+  template<class ViewSel>
+  bool
+  ViewPhaseBrancher<ViewSel>::status(const Space& home) const {
+    if (ViewBrancher<ViewSel>::status(home))
+      return true;
+    // All views are assigned: remember their values as solution phase
+    phase.solution(x);
+    return false;
+  }
+
+  template<class ViewSel>
+  const Choice*
+  ViewPhaseBrancher<ViewSel>::choice(Space& home) {
+    Pos p = ViewBrancher<ViewSel>::pos(home);
+    View x(ViewBrancher<ViewSel>::view(p).varimp());
+    // Try the half containing the saved value first
+    FloatNum n = x.med();
+    double d;
+    bool lower = !phase.phase(p.pos,d) || (d <= n);
+    return new PosValChoice<ViewSel,ValSelBase<View,Val> >
+      (*this,p,viewsel.choice(home),EmptyValSelChoice(),Val(n,lower));
+  }
+
+  template<class ViewSel>
+  const Choice*
+  ViewPhaseBrancher<ViewSel>::choice(const Space& home, Archive& e) {
+    int p; e >> p;
+    typename ViewSel::Choice viewsc = viewsel.choice(home,e);
+    Val v; e >> v;
+    return new PosValChoice<ViewSel,ValSelBase<View,Val> >
+      (*this,p,viewsc,EmptyValSelChoice(),v);
+  }
+
+  template<class ViewSel>
+  ExecStatus
+  ViewPhaseBrancher<ViewSel>
+  ::commit(Space& home, const Choice& c, unsigned int a) {
+    const PosValChoice<ViewSel,ValSelBase<View,Val> >& pvc
+      = static_cast<const PosValChoice<ViewSel,ValSelBase<View,Val> >&>(c);
+    View y(x[pvc.pos().pos]);
+    FloatNum n = pvc.val().first;
+    viewsel.commit(home, pvc.viewchoice(), a);
+    ModEvent me;
+    if ((a == 0) == pvc.val().second) {
+      if ((y.min() == n) || (y.max() == n)) me = y.eq(home,y.min());
+      else me = y.lq(home,n);
+    } else {
+      if ((y.min() == n) || (y.max() == n)) me = y.eq(home,y.max());
+      else me = y.gq(home,n);
+    }
+    return me_failed(me) ? ES_FAILED : ES_OK;
+  }
+
+  template<class ViewSel>
+  forceinline size_t
+  ViewPhaseBrancher<ViewSel>::dispose(Space& home) {
+    if (!viewsel.notice())
+      home.ignore(*this,AP_DISPOSE);
+    phase.~Phase();
+    (void) ViewBrancher<ViewSel>::dispose(home);
+    return sizeof(ViewPhaseBrancher<ViewSel>);
+  }
+
+}}}
+
+// STATISTICS: float-branch
@@ -350,6 +350,86 @@ namespace Gecode { namespace Float { namespace Branch {
     activity.~Activity();
   }
 
+  // Select variable with smallest size/weighted degree
+  forceinline
+  BySizeWDegMin::BySizeWDegMin(void) : sizewdeg(0.0) {}
+  forceinline
+  BySizeWDegMin::BySizeWDegMin(Space& home,
+                               const VarBranchOptions& vbo)
+    : ViewSelBase<FloatView>(home,vbo), wdeg(vbo.wdeg), sizewdeg(0.0) {
+    if (!wdeg.initialized())
+      throw MissingWDeg("BySizeWDegMin (FLOAT_VAR_SIZE_WDEG_MIN)");
+  }
+  forceinline ViewSelStatus
+  BySizeWDegMin::init(Space&, View x, int i) {
+    sizewdeg = static_cast<double>(x.size())/wdeg[i];
+    return VSS_BETTER;
+  }
+  forceinline ViewSelStatus
+  BySizeWDegMin::select(Space&, View x, int i) {
+    double sa = static_cast<double>(x.size())/wdeg[i];
+    if (sa < sizewdeg) {
+      sizewdeg = sa;
+      return VSS_BETTER;
+    } else if (sa > sizewdeg) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+  forceinline void
+  BySizeWDegMin::update(Space& home, bool share, BySizeWDegMin& vs) {
+    wdeg.update(home, share, vs.wdeg);
+  }
+  forceinline bool
+  BySizeWDegMin::notice(void) const {
+    return true;
+  }
+  forceinline void
+  BySizeWDegMin::dispose(Space&) {
+    wdeg.~WDeg();
+  }
+
+  // Select variable with largest size/weighted degree
+  forceinline
+  BySizeWDegMax::BySizeWDegMax(void) : sizewdeg(0.0) {}
+  forceinline
+  BySizeWDegMax::BySizeWDegMax(Space& home,
+                               const VarBranchOptions& vbo)
+    : ViewSelBase<FloatView>(home,vbo), wdeg(vbo.wdeg), sizewdeg(0.0) {
+    if (!wdeg.initialized())
+      throw MissingWDeg("BySizeWDegMax (FLOAT_VAR_SIZE_WDEG_MAX)");
+  }
+  forceinline ViewSelStatus
+  BySizeWDegMax::init(Space&, View x, int i) {
+    sizewdeg = static_cast<double>(x.size())/wdeg[i];
+    return VSS_BETTER;
+  }
+  forceinline ViewSelStatus
+  BySizeWDegMax::select(Space&, View x, int i) {
+    double sa = static_cast<double>(x.size())/wdeg[i];
+    if (sa > sizewdeg) {
+      sizewdeg = sa;
+      return VSS_BETTER;
+    } else if (sa < sizewdeg) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+  forceinline void
+  BySizeWDegMax::update(Space& home, bool share, BySizeWDegMax& vs) {
+    wdeg.update(home, share, vs.wdeg);
+  }
+  forceinline bool
+  BySizeWDegMax::notice(void) const {
+    return true;
+  }
+  forceinline void
+  BySizeWDegMax::dispose(Space&) {
+    wdeg.~WDeg();
+  }
+
 }}}
 
 // STATISTICS: float-branch
@@ -3483,6 +3483,254 @@ namespace Gecode {
     init(Home home, const BoolVarArgs& x, double a);
   };
 
+  /// Recording conflict history based scores for integer variables
+  class IntCHB : public CHB {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized score storage is init or the assignment operator.
+     *
+     */
+    IntCHB(void);
+    /// Copy constructor
+    IntCHB(const IntCHB& a);
+    /// Assignment operator
+    IntCHB& operator =(const IntCHB& a);
+    /// Initialize for integer variables \a x
+    GECODE_INT_EXPORT
+    IntCHB(Home home, const IntVarArgs& x);
+    /**
+     * \brief Initialize for integer variables \a x
+     *
+     * This member function can only be used once and only if the
+     * score storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const IntVarArgs& x);
+  };
+
+  /// Recording conflict history based scores for Boolean variables
+  class BoolCHB : public CHB {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized score storage is init or the assignment operator.
+     *
+     */
+    BoolCHB(void);
+    /// Copy constructor
+    BoolCHB(const BoolCHB& a);
+    /// Assignment operator
+    BoolCHB& operator =(const BoolCHB& a);
+    /// Initialize for Boolean variables \a x
+    GECODE_INT_EXPORT
+    BoolCHB(Home home, const BoolVarArgs& x);
+    /**
+     * \brief Initialize for Boolean variables \a x
+     *
+     * This member function can only be used once and only if the
+     * score storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const BoolVarArgs& x);
+  };
+
+  /// Recording weighted degrees for integer variables
+  class IntWDeg : public WDeg {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized weight storage is init or the assignment operator.
+     *
+     */
+    IntWDeg(void);
+    /// Copy constructor
+    IntWDeg(const IntWDeg& a);
+    /// Assignment operator
+    IntWDeg& operator =(const IntWDeg& a);
+    /// Initialize for integer variables \a x
+    GECODE_INT_EXPORT
+    IntWDeg(Home home, const IntVarArgs& x);
+    /**
+     * \brief Initialize for integer variables \a x
+     *
+     * This member function can only be used once and only if the
+     * weight storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const IntVarArgs& x);
+  };
+
+  /// Recording weighted degrees for Boolean variables
+  class BoolWDeg : public WDeg {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized weight storage is init or the assignment operator.
+     *
+     */
+    BoolWDeg(void);
+    /// Copy constructor
+    BoolWDeg(const BoolWDeg& a);
+    /// Assignment operator
+    BoolWDeg& operator =(const BoolWDeg& a);
+    /// Initialize for Boolean variables \a x
+    GECODE_INT_EXPORT
+    BoolWDeg(Home home, const BoolVarArgs& x);
+    /**
+     * \brief Initialize for Boolean variables \a x
+     *
+     * This member function can only be used once and only if the
+     * weight storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const BoolVarArgs& x);
+  };
+
+  /// Recording impacts for integer variables
+  class IntImpact : public Impact {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized impact storage is init or the assignment operator.
+     *
+     */
+    IntImpact(void);
+    /// Copy constructor
+    IntImpact(const IntImpact& a);
+    /// Assignment operator
+    IntImpact& operator =(const IntImpact& a);
+    /**
+     * \brief Initialize for integer variables \a x
+     *
+     * If \a probe is true, the impact of each value of each
+     * variable is probed when the first choice is computed.
+     *
+     */
+    GECODE_INT_EXPORT
+    IntImpact(Home home, const IntVarArgs& x, bool probe=false);
+    /**
+     * \brief Initialize for integer variables \a x
+     *
+     * If \a probe is true, the impact of each value of each
+     * variable is probed when the first choice is computed.
+     * This member function can only be used once and only if the
+     * impact storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const IntVarArgs& x, bool probe=false);
+  };
+
+  /// Recording impacts for Boolean variables
+  class BoolImpact : public Impact {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized impact storage is init or the assignment operator.
+     *
+     */
+    BoolImpact(void);
+    /// Copy constructor
+    BoolImpact(const BoolImpact& a);
+    /// Assignment operator
+    BoolImpact& operator =(const BoolImpact& a);
+    /**
+     * \brief Initialize for Boolean variables \a x
+     *
+     * If \a probe is true, the impact of each value of each
+     * variable is probed when the first choice is computed.
+     *
+     */
+    GECODE_INT_EXPORT
+    BoolImpact(Home home, const BoolVarArgs& x, bool probe=false);
+    /**
+     * \brief Initialize for Boolean variables \a x
+     *
+     * If \a probe is true, the impact of each value of each
+     * variable is probed when the first choice is computed.
+     * This member function can only be used once and only if the
+     * impact storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const BoolVarArgs& x, bool probe=false);
+  };
+
+  /// Recording phases for integer variables
+  class IntPhase : public Phase {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized phase storage is init or the assignment operator.
+     *
+     */
+    IntPhase(void);
+    /// Copy constructor
+    IntPhase(const IntPhase& a);
+    /// Assignment operator
+    IntPhase& operator =(const IntPhase& a);
+    /// Initialize for integer variables \a x
+    GECODE_INT_EXPORT
+    IntPhase(Home home, const IntVarArgs& x);
+    /**
+     * \brief Initialize for integer variables \a x
+     *
+     * This member function can only be used once and only if the
+     * phase storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const IntVarArgs& x);
+  };
+
+  /// Recording phases for Boolean variables
+  class BoolPhase : public Phase {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized phase storage is init or the assignment operator.
+     *
+     */
+    BoolPhase(void);
+    /// Copy constructor
+    BoolPhase(const BoolPhase& a);
+    /// Assignment operator
+    BoolPhase& operator =(const BoolPhase& a);
+    /// Initialize for Boolean variables \a x
+    GECODE_INT_EXPORT
+    BoolPhase(Home home, const BoolVarArgs& x);
+    /**
+     * \brief Initialize for Boolean variables \a x
+     *
+     * This member function can only be used once and only if the
+     * phase storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const BoolVarArgs& x);
+  };
+
   /// Which variable to select for branching
   enum IntVarBranch {
     INT_VAR_NONE = 0,        ///< First unassigned
@@ -3493,6 +3741,12 @@ namespace Gecode {
     INT_VAR_AFC_MAX,         ///< With largest accumulated failure count
     INT_VAR_ACTIVITY_MIN,    ///< With lowest activity
     INT_VAR_ACTIVITY_MAX,    ///< With highest activity
+    INT_VAR_CHB_MIN,         ///< With lowest conflict history score
+    INT_VAR_CHB_MAX,         ///< With highest conflict history score
+    INT_VAR_WDEG_MIN,        ///< With smallest weighted degree
+    INT_VAR_WDEG_MAX,        ///< With largest weighted degree
+    INT_VAR_IMPACT_MIN,      ///< With smallest average impact of its values
+    INT_VAR_IMPACT_MAX,      ///< With largest average impact of its values
     INT_VAR_MIN_MIN,         ///< With smallest min
     INT_VAR_MIN_MAX,         ///< With largest min
     INT_VAR_MAX_MIN,         ///< With smallest max
@@ -3505,6 +3759,8 @@ namespace Gecode {
     INT_VAR_SIZE_AFC_MAX,    ///< With largest domain size divided by accumulated failure count
     INT_VAR_SIZE_ACTIVITY_MIN, ///< With smallest domain size divided by activity
     INT_VAR_SIZE_ACTIVITY_MAX, ///< With largest domain size divided by activity
+    INT_VAR_SIZE_WDEG_MIN,   ///< With smallest domain size divided by weighted degree
+    INT_VAR_SIZE_WDEG_MAX,   ///< With largest domain size divided by weighted degree
     /** \brief With smallest min-regret
      *
      * The min-regret of a variable is the difference between the
@@ -3541,6 +3797,8 @@ namespace Gecode {
     INT_VAL_SPLIT_MAX, ///< Select values greater than mean of smallest and largest value
     INT_VAL_RANGE_MIN, ///< Select the smallest range of the variable domain if it has sevral ranges, otherwise select values not greater than mean of smallest and largest value
     INT_VAL_RANGE_MAX, ///< Select the largest range of the variable domain if it has sevral ranges, otherwise select values greater than mean of smallest and largest value
+    INT_VAL_IMPACT_MIN, ///< Select value with smallest impact
+    INT_VAL_SOLUTION,  ///< Select value from last solution or failure, otherwise smallest value
     INT_VALUES_MIN,    ///< Try all values starting from smallest
     INT_VALUES_MAX     ///< Try all values starting from largest
   };
@@ -3578,6 +3836,22 @@ namespace Gecode {
   branch(Home home, BoolVar x, IntValBranch vals,
          const ValBranchOptions& o_vals = ValBranchOptions::def);
 
+  /**
+   * \brief Branch over \a x by counting-based search
+   *
+   * Selects the variable and value with maximal solution density
+   * as estimated by the propagators for distinct, global cardinality,
+   * and regular constraints (maxSD). The alternatives are that the
+   * variable is equal or not equal to the value. If no density is
+   * available, the first unassigned variable and its smallest value
+   * are selected.
+   */
+  GECODE_INT_EXPORT void
+  cbsbranch(Home home, const IntVarArgs& x);
+  /// Branch over \a x by counting-based search
+  GECODE_INT_EXPORT void
+  cbsbranch(Home home, const BoolVarArgs& x);
+
   //@}
 
   /**
@@ -3614,6 +3888,10 @@ namespace Gecode {
 }
 
 #include <gecode/int/activity.hpp>
+#include <gecode/int/chb.hpp>
+#include <gecode/int/wdeg.hpp>
+#include <gecode/int/impact.hpp>
+#include <gecode/int/phase.hpp>
 
 namespace Gecode {
 
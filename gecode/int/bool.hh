@@ -520,6 +520,9 @@ namespace Gecode { namespace Int { namespace Bool {
     virtual Actor* copy(Space& home, bool share);
     /// Give advice to propagator
     virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Give advice to propagator for several advisors
+    virtual ExecStatus advise_batch(Space& home, Advisor* a[], int n,
+                                    const Delta& d);
     /// Cost function (defined as low unary)
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Perform propagation
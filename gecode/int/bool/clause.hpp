@@ -326,6 +326,22 @@ namespace Gecode { namespace Int { namespace Bool {
     return ES_NOFIX;
   }
 
+  template<class VX, class VY>
+  ExecStatus
+  Clause<VX,VY>::advise_batch(Space&, Advisor* _a[], int n, const Delta& d) {
+    // All advisors are advised about the same view
+    bool vx = VX::zero(d), vy = VY::zero(d);
+    bool run = false;
+    for (int i=n; i--; ) {
+      const Tagged& a = *static_cast<Tagged*>(_a[i]);
+      if ((a.x && vx) || (!a.x && vy))
+        n_zero++;
+      else
+        run = true;
+    }
+    return (run || (n_zero >= x.size() + y.size())) ? ES_NOFIX : ES_FIX;
+  }
+
   template<class VX, class VY>
   ExecStatus
   Clause<VX,VY>::propagate(Space& home, const ModEventDelta&) {
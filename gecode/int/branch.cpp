@@ -133,6 +133,22 @@ namespace Gecode {
     branch(home, xv, INT_VAR_NONE, vals, VarBranchOptions::def, o_vals);
   }
   
+  void
+  cbsbranch(Home home, const IntVarArgs& x) {
+    using namespace Int;
+    if (home.failed()) return;
+    ViewArray<IntView> xv(home,x);
+    Branch::CBSBrancher<IntView>::post(home,xv);
+  }
+
+  void
+  cbsbranch(Home home, const BoolVarArgs& x) {
+    using namespace Int;
+    if (home.failed()) return;
+    ViewArray<BoolView> xv(home,x);
+    Branch::CBSBrancher<BoolView>::post(home,xv);
+  }
+
   void
   assign(Home home, IntVar x, IntAssign vals,
          const ValBranchOptions& o_vals) {
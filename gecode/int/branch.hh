@@ -245,6 +245,169 @@ namespace Gecode { namespace Int { namespace Branch {
   };
 
 
+  /**
+   * \brief %Brancher by view selection and value with smallest impact
+   *
+   * The brancher tries to assign the selected view to the value with
+   * the smallest impact first and records the impact of the
+   * assignment. If impact probing has been requested, all values
+   * of all views are probed before the first choice is computed.
+   *
+   */
+  template<class ViewSel>
+  class ViewImpactBrancher : public ViewBrancher<ViewSel> {
+  protected:
+    /// The view type
+    typedef typename ViewSel::View View;
+    using ViewBrancher<ViewSel>::x;
+    using ViewBrancher<ViewSel>::viewsel;
+    using ViewBrancher<ViewSel>::bf;
+    /// Impact information
+    Impact impact;
+    /// Probe impact of all values of all views
+    void probe(Space& home);
+    /// Constructor for cloning \a b
+    ViewImpactBrancher(Space& home, bool share, ViewImpactBrancher& b);
+    /// Constructor for creation
+    ViewImpactBrancher(Home home, ViewArray<View>& x,
+                       ViewSel& vi_s, const Impact& impact, 
+                       BranchFilter bf);
+  public:
+    /// Return choice
+    virtual const Choice* choice(Space& home);
+    /// Return choice
+    virtual const Choice* choice(const Space& home, Archive& e);
+    /// Perform commit for choice \a c and alternative \a a
+    virtual ExecStatus commit(Space& home, const Choice& c, unsigned int a);
+    /// Perform cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Delete brancher and return its size
+    virtual size_t dispose(Space& home);
+    /// Brancher post function
+    static void post(Home home, ViewArray<View>& x,
+                     ViewSel& vi_s, const Impact& impact, 
+                     BranchFilter bf=NULL);
+  };
+
+  /**
+   * \brief %Brancher by view selection and value from last solution
+   *
+   * The brancher first tries to assign the selected view to its value
+   * in the last solution found or, if no solution has been found yet,
+   * to its value at the last failure. If no such value is known or the
+   * value has been pruned, the smallest value is tried. When the
+   * brancher has no more views to branch on, the values of all views
+   * are recorded as solution phase.
+   *
+   */
+  template<class ViewSel>
+  class ViewPhaseBrancher : public ViewBrancher<ViewSel> {
+  protected:
+    /// The view type
+    typedef typename ViewSel::View View;
+    using ViewBrancher<ViewSel>::x;
+    using ViewBrancher<ViewSel>::viewsel;
+    /// Phase information (updated when the brancher is done)
+    mutable Phase phase;
+    /// Constructor for cloning \a b
+    ViewPhaseBrancher(Space& home, bool share, ViewPhaseBrancher& b);
+    /// Constructor for creation
+    ViewPhaseBrancher(Home home, ViewArray<View>& x,
+                      ViewSel& vi_s, const Phase& phase, 
+                      BranchFilter bf);
+  public:
+    /// Check status of brancher, record solution phase if done
+    virtual bool status(const Space& home) const;
+    /// Return choice
+    virtual const Choice* choice(Space& home);
+    /// Return choice
+    virtual const Choice* choice(const Space& home, Archive& e);
+    /// Perform commit for choice \a c and alternative \a a
+    virtual ExecStatus commit(Space& home, const Choice& c, unsigned int a);
+    /// Perform cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Delete brancher and return its size
+    virtual size_t dispose(Space& home);
+    /// Brancher post function
+    static void post(Home home, ViewArray<View>& x,
+                     ViewSel& vi_s, const Phase& phase, 
+                     BranchFilter bf=NULL);
+  };
+
+  /**
+   * \brief %Brancher for counting-based search
+   *
+   * The brancher collects the solution densities reported by all
+   * propagators (see Propagator::solndistrib) and selects the
+   * variable-value pair with maximal density. It then creates the
+   * alternatives that the view is equal to the value and that the
+   * view is not equal to the value. If no propagator reports a
+   * density, the first unassigned view and its smallest value are
+   * selected.
+   *
+   */
+  template<class View>
+  class CBSBrancher : public Brancher {
+  protected:
+    /// Views to branch on
+    ViewArray<View> x;
+    /// Unassigned views start at x[start]
+    mutable int start;
+    /// Solution distribution keeping track of the maximal density
+    class MaxDensity : public SolnDistribution {
+    public:
+      /// Variable implementation with position of its view
+      class Idx {
+      public:
+        /// Variable implementation
+        const VarImpBase* x;
+        /// Position of view
+        int pos;
+        /// Test whether \a i comes before \a j
+        bool operator ()(const Idx& i, const Idx& j);
+      };
+    protected:
+      /// Variable implementations sorted by address
+      Idx* idx;
+      /// Number of variable implementations
+      int n;
+      /// Return position of view for \a x or -1 if none
+      int find(const VarImpBase* x) const;
+    public:
+      /// Position of view with maximal density (-1 if none)
+      int pos;
+      /// Value with maximal density
+      int val;
+      /// Maximal density
+      double dens;
+      /// Initialize for \a n sorted variable implementations \a idx
+      MaxDensity(Idx* idx, int n);
+      /// Test whether densities for variable implementation \a x are needed
+      virtual bool supports(const VarImpBase* x) const;
+      /// Report density \a d for variable implementation \a x and value \a v
+      virtual void marginal(const VarImpBase* x, int v, double d);
+    };
+    /// Constructor for cloning \a b
+    CBSBrancher(Space& home, bool share, CBSBrancher& b);
+    /// Constructor for creation
+    CBSBrancher(Home home, ViewArray<View>& x);
+  public:
+    /// Check status of brancher, return true if alternatives left
+    virtual bool status(const Space& home) const;
+    /// Return choice
+    virtual const Choice* choice(Space& home);
+    /// Return choice
+    virtual const Choice* choice(const Space& home, Archive& e);
+    /// Perform commit for choice \a c and alternative \a a
+    virtual ExecStatus commit(Space& home, const Choice& c, unsigned int a);
+    /// Perform cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Delete brancher and return its size
+    virtual size_t dispose(Space& home);
+    /// Brancher post function
+    static void post(Home home, ViewArray<View>& x);
+  };
+
   /// Class for assigning minimum value
   template<class View>
   class AssignValMin : public ValMin<View> {
@@ -568,6 +731,124 @@ namespace Gecode { namespace Int { namespace Branch {
     void dispose(Space& home);
   };
 
+  /**
+   * \brief View selection class for view with smallest size divided by weighted degree
+   *
+   * Requires \code #include <gecode/int/branch.hh> \endcode
+   * \ingroup FuncIntSelView
+   */
+  class BySizeWDegMin : public ViewSelBase<IntView> {
+  protected:
+    /// Weighted degree information
+    WDeg wdeg;
+    /// So-far smallest size/weighted degree
+    double sizewdeg;
+  public:
+    /// Default constructor
+    BySizeWDegMin(void);
+    /// Constructor for initialization
+    BySizeWDegMin(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, View x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, View x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, BySizeWDegMin& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
+  /**
+   * \brief View selection class for view with largest size divided by weighted degree
+   *
+   * Requires \code #include <gecode/int/branch.hh> \endcode
+   * \ingroup FuncIntSelView
+   */
+  class BySizeWDegMax : public ViewSelBase<IntView> {
+  protected:
+    /// Weighted degree information
+    WDeg wdeg;
+    /// So-far largest size/weighted degree
+    double sizewdeg;
+  public:
+    /// Default constructor
+    BySizeWDegMax(void);
+    /// Constructor for initialization
+    BySizeWDegMax(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, View x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, View x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, BySizeWDegMax& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
+  /**
+   * \brief View selection class for view with smallest average impact
+   *
+   * Requires \code #include <gecode/int/branch.hh> \endcode
+   * \ingroup FuncIntSelView
+   */
+  template<class View>
+  class ByImpactMin : public ViewSelBase<View> {
+  protected:
+    /// Impact information
+    Impact impact;
+    /// So-far smallest average impact
+    double imp;
+  public:
+    /// Default constructor
+    ByImpactMin(void);
+    /// Constructor for initialization
+    ByImpactMin(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, View x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, View x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, ByImpactMin& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
+  /**
+   * \brief View selection class for view with largest average impact
+   *
+   * Requires \code #include <gecode/int/branch.hh> \endcode
+   * \ingroup FuncIntSelView
+   */
+  template<class View>
+  class ByImpactMax : public ViewSelBase<View> {
+  protected:
+    /// Impact information
+    Impact impact;
+    /// So-far largest average impact
+    double imp;
+  public:
+    /// Default constructor
+    ByImpactMax(void);
+    /// Constructor for initialization
+    ByImpactMax(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, View x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, View x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, ByImpactMax& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
   /**
    * \brief View selection class for view with smallest min-regret
    *
@@ -656,6 +937,9 @@ namespace Gecode { namespace Int { namespace Branch {
 
 #include <gecode/int/branch/select-val.hpp>
 #include <gecode/int/branch/select-values.hpp>
+#include <gecode/int/branch/select-impact.hpp>
+#include <gecode/int/branch/select-phase.hpp>
+#include <gecode/int/branch/cbs.hpp>
 #include <gecode/int/branch/select-view.hpp>
 #include <gecode/int/branch/post-val-int.hpp>
 #include <gecode/int/branch/post-val-bool.hpp>
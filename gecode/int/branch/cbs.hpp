@@ -0,0 +1,188 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Branch {
+
+  /*
+   * Collecting the maximal density
+   *
+   */
+  template<class View>
+  forceinline bool
+  CBSBrancher<View>::MaxDensity::Idx::operator ()(const Idx& i,
+                                                   const Idx& j) {
+    return i.x < j.x;
+  }
+
+  template<class View>
+  forceinline
+  CBSBrancher<View>::MaxDensity::MaxDensity(Idx* idx0, int n0)
+    : idx(idx0), n(n0), pos(-1), val(0), dens(0.0) {}
+
+  template<class View>
+  forceinline int
+  CBSBrancher<View>::MaxDensity::find(const VarImpBase* x) const {
+    int l=0, r=n-1;
+    while (l <= r) {
+      int m = l + (r-l)/2;
+      if (idx[m].x == x)
+        return idx[m].pos;
+      else if (idx[m].x < x)
+        l=m+1;
+      else
+        r=m-1;
+    }
+    return -1;
+  }
+
+  template<class View>
+  bool
+  CBSBrancher<View>::MaxDensity::supports(const VarImpBase* x) const {
+    return find(x) >= 0;
+  }
+
+  template<class View>
+  void
+  CBSBrancher<View>::MaxDensity::marginal(const VarImpBase* x, int v,
+                                          double d) {
+    if ((pos < 0) || (d > dens)) {
+      int p = find(x);
+      if (p >= 0) {
+        pos = p; val = v; dens = d;
+      }
+    }
+  }
+
+
+  /*
+   * The brancher
+   *
+   */
+  template<class View>
+  forceinline
+  CBSBrancher<View>::CBSBrancher(Home home, ViewArray<View>& x0)
+    : Brancher(home), x(x0), start(0) {}
+
+  template<class View>
+  void
+  CBSBrancher<View>::post(Home home, ViewArray<View>& x) {
+    (void) new (home) CBSBrancher<View>(home,x);
+  }
+
+  template<class View>
+  forceinline
+  CBSBrancher<View>::CBSBrancher(Space& home, bool share, CBSBrancher& b)
+    : Brancher(home,share,b), start(b.start) {
+    x.update(home,share,b.x);
+  }
+
+  template<class View>
+  Actor*
+  CBSBrancher<View>::copy(Space& home, bool share) {
+    return new (home) CBSBrancher<View>(home,share,*this);
+  }
+
+  template<class View>
+  bool
+  CBSBrancher<View>::status(const Space&) const {
+    for (int i=start; i < x.size(); i++)
+      if (!x[i].assigned()) {
+        start = i;
+        return true;
+      }
+    return false;
+  }
+
+  template<class View>
+  const Choice*
+  CBSBrancher<View>::choice(Space& home) {
+    typedef PosValChoice<ViewSelNone<View>,ValSelBase<View,int> > PVC;
+    Region r(home);
+    typename MaxDensity::Idx* idx
+      = r.alloc<typename MaxDensity::Idx>(x.size()-start);
+    int n = 0;
+    for (int i=start; i < x.size(); i++)
+      if (!x[i].assigned()) {
+        idx[n].x = x[i].varimp(); idx[n].pos = i; n++;
+      }
+    typename MaxDensity::Idx il;
+    Support::quicksort<typename MaxDensity::Idx,
+                       typename MaxDensity::Idx>(idx,n,il);
+    MaxDensity md(idx,n);
+    for (Space::Propagators p(home); p(); ++p)
+      p.propagator().solndistrib(home,md);
+    if ((md.pos >= 0) && x[md.pos].in(md.val))
+      return new PVC(*this,md.pos,EmptyViewSelChoice(),
+                     EmptyValSelChoice(),md.val);
+    // No density available: select first unassigned view
+    return new PVC(*this,start,EmptyViewSelChoice(),
+                   EmptyValSelChoice(),x[start].min());
+  }
+
+  template<class View>
+  const Choice*
+  CBSBrancher<View>::choice(const Space&, Archive& e) {
+    int p; e >> p;
+    int v; e >> v;
+    return new PosValChoice<ViewSelNone<View>,ValSelBase<View,int> >
+      (*this,p,EmptyViewSelChoice(),EmptyValSelChoice(),v);
+  }
+
+  template<class View>
+  ExecStatus
+  CBSBrancher<View>::commit(Space& home, const Choice& c, unsigned int a) {
+    const PosValChoice<ViewSelNone<View>,ValSelBase<View,int> >& pvc
+      = static_cast<const PosValChoice<ViewSelNone<View>,
+                                       ValSelBase<View,int> >&>(c);
+    int i = pvc.pos().pos;
+    int v = pvc.val();
+    if (a == 0)
+      return me_failed(x[i].eq(home,v)) ? ES_FAILED : ES_OK;
+    else
+      return me_failed(x[i].nq(home,v)) ? ES_FAILED : ES_OK;
+  }
+
+  template<class View>
+  forceinline size_t
+  CBSBrancher<View>::dispose(Space& home) {
+    (void) Brancher::dispose(home);
+    return sizeof(CBSBrancher<View>);
+  }
+
+}}}
+
+// STATISTICS: int-branch
@@ -37,11 +37,15 @@
 
 namespace Gecode { namespace Int { namespace Branch {
 
-  /// Post brancher according to \a v and \a vals
-  template<class SelView>
+  /// Post brancher according to \a vs, \a vals, and \a o_vars
+  template<class ViewSel>
   void
-  post(Space& home, ViewArray<BoolView>& x, SelView& v,
-       IntValBranch vals, const ValBranchOptions& o_vals, BranchFilter bf) {
+  post(Space& home, ViewArray<BoolView>& x, ViewSel& vs,
+       IntValBranch vals, const ValBranchOptions& o_vals,
+       const VarBranchOptions& o_vars) {
+    typedef ViewSelLastConflict<ViewSel> SelView;
+    SelView v(home,vs,o_vars);
+    BranchFilter bf = o_vars.bf;
     switch (vals) {
     case INT_VAL_MIN:
     case INT_VAL_MED:
@@ -64,6 +68,20 @@ namespace Gecode { namespace Int { namespace Branch {
           ::post(home,x,v,a,bf);
       }
       break;
+    case INT_VAL_IMPACT_MIN:
+      if (!o_vals.impact.initialized())
+        throw MissingImpact("Int::branch (INT_VAL_IMPACT_MIN)");
+      if (o_vals.impact.size() != x.size())
+        throw ImpactWrongArity("Int::branch");
+      ViewImpactBrancher<SelView>::post(home,x,v,o_vals.impact,bf);
+      break;
+    case INT_VAL_SOLUTION:
+      if (!o_vals.phase.initialized())
+        throw MissingPhase("Int::branch (INT_VAL_SOLUTION)");
+      if (o_vals.phase.size() != x.size())
+        throw PhaseWrongArity("Int::branch");
+      ViewPhaseBrancher<SelView>::post(home,x,v,o_vals.phase,bf);
+      break;
     case INT_VAL_RND:
       {
         ValRnd<BoolView> a(home,o_vals);
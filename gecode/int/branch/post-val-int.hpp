@@ -37,11 +37,15 @@
 
 namespace Gecode { namespace Int { namespace Branch {
 
-  /// Post brancher according to \a v and \a vals
-  template<class SelView>
+  /// Post brancher according to \a vs, \a vals, and \a o_vars
+  template<class ViewSel>
   void
-  post(Space& home, ViewArray<IntView>& x, SelView& v,
-       IntValBranch vals, const ValBranchOptions& o_vals, BranchFilter bf) {
+  post(Space& home, ViewArray<IntView>& x, ViewSel& vs,
+       IntValBranch vals, const ValBranchOptions& o_vals,
+       const VarBranchOptions& o_vars) {
+    typedef ViewSelLastConflict<ViewSel> SelView;
+    SelView v(home,vs,o_vars);
+    BranchFilter bf = o_vars.bf;
     switch (vals) {
     case INT_VAL_MIN:
       {
@@ -91,6 +95,20 @@ namespace Gecode { namespace Int { namespace Branch {
         ViewValBrancher<SelView,ValRangeMin<MinusView> >::post(home,x,v,a,bf);
       }
       break;
+    case INT_VAL_IMPACT_MIN:
+      if (!o_vals.impact.initialized())
+        throw MissingImpact("Int::branch (INT_VAL_IMPACT_MIN)");
+      if (o_vals.impact.size() != x.size())
+        throw ImpactWrongArity("Int::branch");
+      ViewImpactBrancher<SelView>::post(home,x,v,o_vals.impact,bf);
+      break;
+    case INT_VAL_SOLUTION:
+      if (!o_vals.phase.initialized())
+        throw MissingPhase("Int::branch (INT_VAL_SOLUTION)");
+      if (o_vals.phase.size() != x.size())
+        throw PhaseWrongArity("Int::branch");
+      ViewPhaseBrancher<SelView>::post(home,x,v,o_vals.phase,bf);
+      break;
     case INT_VALUES_MIN:
       ViewValuesBrancher<SelView,IntView>::post(home,x,v,bf);
       break;
@@ -88,6 +88,24 @@ namespace Gecode { namespace Int { namespace Branch {
     case INT_VAR_ACTIVITY_MAX:
       v = new (home) ViewSelVirtual<ViewSelActivityMax<BoolView> >(home,o_vars);
       break;
+    case INT_VAR_CHB_MIN:
+      v = new (home) ViewSelVirtual<ViewSelCHBMin<BoolView> >(home,o_vars);
+      break;
+    case INT_VAR_CHB_MAX:
+      v = new (home) ViewSelVirtual<ViewSelCHBMax<BoolView> >(home,o_vars);
+      break;
+    case INT_VAR_WDEG_MIN:
+      v = new (home) ViewSelVirtual<ViewSelWDegMin<BoolView> >(home,o_vars);
+      break;
+    case INT_VAR_WDEG_MAX:
+      v = new (home) ViewSelVirtual<ViewSelWDegMax<BoolView> >(home,o_vars);
+      break;
+    case INT_VAR_IMPACT_MIN:
+      v = new (home) ViewSelVirtual<ByImpactMin<BoolView> >(home,o_vars);
+      break;
+    case INT_VAR_IMPACT_MAX:
+      v = new (home) ViewSelVirtual<ByImpactMax<BoolView> >(home,o_vars);
+      break;
     case INT_VAR_SIZE_DEGREE_MIN:
       v = new (home) ViewSelVirtual<ViewSelDegreeMax<BoolView> >(home,o_vars);
       break;
@@ -106,6 +124,12 @@ namespace Gecode { namespace Int { namespace Branch {
     case INT_VAR_SIZE_ACTIVITY_MAX:
       v = new (home) ViewSelVirtual<ViewSelActivityMin<BoolView> >(home,o_vars);
       break;
+    case INT_VAR_SIZE_WDEG_MIN:
+      v = new (home) ViewSelVirtual<ViewSelWDegMax<BoolView> >(home,o_vars);
+      break;
+    case INT_VAR_SIZE_WDEG_MAX:
+      v = new (home) ViewSelVirtual<ViewSelWDegMin<BoolView> >(home,o_vars);
+      break;
     case INT_VAR_REGRET_MIN_MIN:
       v = new (home) ViewSelVirtual<ViewSelNone<BoolView> >(home,o_vars);
       break;
@@ -141,150 +165,207 @@ namespace Gecode {
     if (o_vars.activity.initialized() &&
         (o_vars.activity.size() != x.size()))
       throw ActivityWrongArity("branch");
+    if (o_vars.chb.initialized() &&
+        (o_vars.chb.size() != x.size()))
+      throw CHBWrongArity("branch");
+    if (o_vars.wdeg.initialized() &&
+        (o_vars.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch");
+    if (o_vars.impact.initialized() &&
+        (o_vars.impact.size() != x.size()))
+      throw ImpactWrongArity("branch");
     ViewArray<BoolView> xv(home,x);
     switch (vars) {
     case INT_VAR_NONE:
       {
         ViewSelNone<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_RND:
       {
         ViewSelRnd<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_MIN_MIN:
       {
         ViewSelNone<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_MIN_MAX:
       {
         ViewSelNone<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_MAX_MIN:
       {
         ViewSelNone<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_MAX_MAX:
       {
         ViewSelNone<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_MIN:
       {
         ViewSelNone<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_MAX:
       {
         ViewSelNone<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_DEGREE_MIN:
       {
         ViewSelDegreeMin<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_DEGREE_MAX:
       {
         ViewSelDegreeMax<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_AFC_MIN:
       {
         ViewSelAfcMin<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_AFC_MAX:
       {
         ViewSelAfcMax<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_ACTIVITY_MIN:
       {
         ViewSelActivityMin<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_ACTIVITY_MAX:
       {
         ViewSelActivityMax<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_CHB_MIN:
+      {
+        ViewSelCHBMin<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_CHB_MAX:
+      {
+        ViewSelCHBMax<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_WDEG_MIN:
+      {
+        ViewSelWDegMin<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_WDEG_MAX:
+      {
+        ViewSelWDegMax<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_IMPACT_MIN:
+      {
+        ByImpactMin<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_IMPACT_MAX:
+      {
+        ByImpactMax<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_DEGREE_MIN:
       {
         ViewSelDegreeMax<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_DEGREE_MAX:
       {
         ViewSelDegreeMin<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_AFC_MIN:
       {
         ViewSelAfcMax<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_AFC_MAX:
       {
         ViewSelAfcMin<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_ACTIVITY_MIN:
       {
         ViewSelActivityMax<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_ACTIVITY_MAX:
       {
         ViewSelActivityMin<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_SIZE_WDEG_MIN:
+      {
+        ViewSelWDegMax<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_SIZE_WDEG_MAX:
+      {
+        ViewSelWDegMin<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_REGRET_MIN_MIN:
       {
         ViewSelNone<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_REGRET_MIN_MAX:
       {
         ViewSelNone<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_REGRET_MAX_MIN:
       {
         ViewSelNone<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_REGRET_MAX_MAX:
       {
         ViewSelNone<BoolView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     default:
@@ -312,15 +393,51 @@ namespace Gecode {
     if (o_vars.a.activity.initialized() &&
         (o_vars.a.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option a)");
+    if (o_vars.a.chb.initialized() &&
+        (o_vars.a.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option a)");
+    if (o_vars.a.wdeg.initialized() &&
+        (o_vars.a.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option a)");
+    if (o_vars.a.impact.initialized() &&
+        (o_vars.a.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option a)");
     if (o_vars.b.activity.initialized() &&
         (o_vars.b.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option b)");
+    if (o_vars.b.chb.initialized() &&
+        (o_vars.b.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option b)");
+    if (o_vars.b.wdeg.initialized() &&
+        (o_vars.b.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option b)");
+    if (o_vars.b.impact.initialized() &&
+        (o_vars.b.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option b)");
     if (o_vars.c.activity.initialized() &&
         (o_vars.c.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option c)");
+    if (o_vars.c.chb.initialized() &&
+        (o_vars.c.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option c)");
+    if (o_vars.c.wdeg.initialized() &&
+        (o_vars.c.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option c)");
+    if (o_vars.c.impact.initialized() &&
+        (o_vars.c.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option c)");
     if (o_vars.d.activity.initialized() &&
         (o_vars.d.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option d)");
+    if (o_vars.d.chb.initialized() &&
+        (o_vars.d.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option d)");
+    if (o_vars.d.wdeg.initialized() &&
+        (o_vars.d.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option d)");
+    if (o_vars.d.impact.initialized() &&
+        (o_vars.d.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option d)");
     ViewArray<BoolView> xv(home,x);
     Gecode::ViewSelVirtualBase<BoolView>* tb[3];
     int n=0;
@@ -338,7 +455,7 @@ namespace Gecode {
         ViewSelNone<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelNone<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_MIN_MAX:
@@ -346,7 +463,7 @@ namespace Gecode {
         ViewSelNone<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelNone<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_MAX_MIN:
@@ -354,7 +471,7 @@ namespace Gecode {
         ViewSelNone<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelNone<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_MAX_MAX:
@@ -362,7 +479,7 @@ namespace Gecode {
         ViewSelNone<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelNone<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_MIN:
@@ -370,7 +487,7 @@ namespace Gecode {
         ViewSelNone<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelNone<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_MAX:
@@ -378,7 +495,7 @@ namespace Gecode {
         ViewSelNone<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelNone<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_DEGREE_MIN:
@@ -386,7 +503,7 @@ namespace Gecode {
         ViewSelDegreeMin<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelDegreeMin<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_DEGREE_MAX:
@@ -394,7 +511,7 @@ namespace Gecode {
         ViewSelDegreeMax<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelDegreeMax<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_AFC_MIN:
@@ -402,7 +519,7 @@ namespace Gecode {
         ViewSelAfcMin<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelAfcMin<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_AFC_MAX:
@@ -410,7 +527,7 @@ namespace Gecode {
         ViewSelAfcMax<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelAfcMax<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_ACTIVITY_MIN:
@@ -418,7 +535,7 @@ namespace Gecode {
         ViewSelActivityMin<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelActivityMin<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_ACTIVITY_MAX:
@@ -426,7 +543,55 @@ namespace Gecode {
         ViewSelActivityMax<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelActivityMax<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_CHB_MIN:
+      {
+        ViewSelCHBMin<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelCHBMin<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_CHB_MAX:
+      {
+        ViewSelCHBMax<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelCHBMax<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_WDEG_MIN:
+      {
+        ViewSelWDegMin<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelWDegMin<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_WDEG_MAX:
+      {
+        ViewSelWDegMax<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelWDegMax<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_IMPACT_MIN:
+      {
+        ByImpactMin<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ByImpactMin<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_IMPACT_MAX:
+      {
+        ByImpactMax<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ByImpactMax<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_DEGREE_MIN:
@@ -434,7 +599,7 @@ namespace Gecode {
         ViewSelDegreeMax<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelDegreeMax<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_DEGREE_MAX:
@@ -442,7 +607,7 @@ namespace Gecode {
         ViewSelDegreeMin<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelDegreeMin<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_AFC_MIN:
@@ -450,7 +615,7 @@ namespace Gecode {
         ViewSelAfcMax<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelAfcMax<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_AFC_MAX:
@@ -458,7 +623,7 @@ namespace Gecode {
         ViewSelAfcMin<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelAfcMin<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_ACTIVITY_MIN:
@@ -466,7 +631,7 @@ namespace Gecode {
         ViewSelActivityMax<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelActivityMax<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_ACTIVITY_MAX:
@@ -474,7 +639,23 @@ namespace Gecode {
         ViewSelActivityMin<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelActivityMin<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_SIZE_WDEG_MIN:
+      {
+        ViewSelWDegMax<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelWDegMax<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_SIZE_WDEG_MAX:
+      {
+        ViewSelWDegMin<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelWDegMin<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_REGRET_MIN_MIN:
@@ -482,7 +663,7 @@ namespace Gecode {
         ViewSelNone<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelNone<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_REGRET_MIN_MAX:
@@ -490,7 +671,7 @@ namespace Gecode {
         ViewSelNone<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelNone<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_REGRET_MAX_MIN:
@@ -498,7 +679,7 @@ namespace Gecode {
         ViewSelNone<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelNone<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_REGRET_MAX_MAX:
@@ -506,7 +687,7 @@ namespace Gecode {
         ViewSelNone<BoolView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelNone<BoolView>,
           ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     default:
@@ -88,6 +88,24 @@ namespace Gecode { namespace Int { namespace Branch {
     case INT_VAR_ACTIVITY_MAX:
       v = new (home) ViewSelVirtual<ViewSelActivityMax<IntView> >(home,o_vars);
       break;
+    case INT_VAR_CHB_MIN:
+      v = new (home) ViewSelVirtual<ViewSelCHBMin<IntView> >(home,o_vars);
+      break;
+    case INT_VAR_CHB_MAX:
+      v = new (home) ViewSelVirtual<ViewSelCHBMax<IntView> >(home,o_vars);
+      break;
+    case INT_VAR_WDEG_MIN:
+      v = new (home) ViewSelVirtual<ViewSelWDegMin<IntView> >(home,o_vars);
+      break;
+    case INT_VAR_WDEG_MAX:
+      v = new (home) ViewSelVirtual<ViewSelWDegMax<IntView> >(home,o_vars);
+      break;
+    case INT_VAR_IMPACT_MIN:
+      v = new (home) ViewSelVirtual<ByImpactMin<IntView> >(home,o_vars);
+      break;
+    case INT_VAR_IMPACT_MAX:
+      v = new (home) ViewSelVirtual<ByImpactMax<IntView> >(home,o_vars);
+      break;
     case INT_VAR_SIZE_DEGREE_MIN:
       v = new (home) ViewSelVirtual<BySizeDegreeMin>(home,o_vars);
       break;
@@ -106,6 +124,12 @@ namespace Gecode { namespace Int { namespace Branch {
     case INT_VAR_SIZE_ACTIVITY_MAX:
       v = new (home) ViewSelVirtual<BySizeActivityMax>(home,o_vars);
       break;
+    case INT_VAR_SIZE_WDEG_MIN:
+      v = new (home) ViewSelVirtual<BySizeWDegMin>(home,o_vars);
+      break;
+    case INT_VAR_SIZE_WDEG_MAX:
+      v = new (home) ViewSelVirtual<BySizeWDegMax>(home,o_vars);
+      break;
     case INT_VAR_REGRET_MIN_MIN:
       v = new (home) ViewSelVirtual<ByRegretMinMin>(home,o_vars);
       break;
@@ -141,150 +165,207 @@ namespace Gecode {
     if (o_vars.activity.initialized() &&
         (o_vars.activity.size() != x.size()))
       throw ActivityWrongArity("branch");
+    if (o_vars.chb.initialized() &&
+        (o_vars.chb.size() != x.size()))
+      throw CHBWrongArity("branch");
+    if (o_vars.wdeg.initialized() &&
+        (o_vars.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch");
+    if (o_vars.impact.initialized() &&
+        (o_vars.impact.size() != x.size()))
+      throw ImpactWrongArity("branch");
     ViewArray<IntView> xv(home,x);
     switch (vars) {
     case INT_VAR_NONE:
       {
         ViewSelNone<IntView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_RND:
       {
         ViewSelRnd<IntView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_MIN_MIN:
       {
         ByMinMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_MIN_MAX:
       {
         ByMinMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_MAX_MIN:
       {
         ByMaxMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_MAX_MAX:
       {
         ByMaxMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_MIN:
       {
         BySizeMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_MAX:
       {
         BySizeMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_DEGREE_MIN:
       {
         ViewSelDegreeMin<IntView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_DEGREE_MAX:
       {
         ViewSelDegreeMax<IntView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_AFC_MIN:
       {
         ViewSelAfcMin<IntView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_AFC_MAX:
       {
         ViewSelAfcMax<IntView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_ACTIVITY_MIN:
       {
         ViewSelActivityMin<IntView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_ACTIVITY_MAX:
       {
         ViewSelActivityMax<IntView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_CHB_MIN:
+      {
+        ViewSelCHBMin<IntView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_CHB_MAX:
+      {
+        ViewSelCHBMax<IntView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_WDEG_MIN:
+      {
+        ViewSelWDegMin<IntView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_WDEG_MAX:
+      {
+        ViewSelWDegMax<IntView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_IMPACT_MIN:
+      {
+        ByImpactMin<IntView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_IMPACT_MAX:
+      {
+        ByImpactMax<IntView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_DEGREE_MIN:
       {
         BySizeDegreeMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_DEGREE_MAX:
       {
         BySizeDegreeMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_AFC_MIN:
       {
         BySizeAfcMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_AFC_MAX:
       {
         BySizeAfcMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_ACTIVITY_MIN:
       {
         BySizeActivityMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_SIZE_ACTIVITY_MAX:
       {
         BySizeActivityMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_SIZE_WDEG_MIN:
+      {
+        BySizeWDegMin v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case INT_VAR_SIZE_WDEG_MAX:
+      {
+        BySizeWDegMax v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_REGRET_MIN_MIN:
       {
         ByRegretMinMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_REGRET_MIN_MAX:
       {
         ByRegretMinMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_REGRET_MAX_MIN:
       {
         ByRegretMaxMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case INT_VAR_REGRET_MAX_MAX:
       {
         ByRegretMaxMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     default:
@@ -312,15 +393,51 @@ namespace Gecode {
     if (o_vars.a.activity.initialized() &&
         (o_vars.a.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option a)");
+    if (o_vars.a.chb.initialized() &&
+        (o_vars.a.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option a)");
+    if (o_vars.a.wdeg.initialized() &&
+        (o_vars.a.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option a)");
+    if (o_vars.a.impact.initialized() &&
+        (o_vars.a.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option a)");
     if (o_vars.b.activity.initialized() &&
         (o_vars.b.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option b)");
+    if (o_vars.b.chb.initialized() &&
+        (o_vars.b.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option b)");
+    if (o_vars.b.wdeg.initialized() &&
+        (o_vars.b.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option b)");
+    if (o_vars.b.impact.initialized() &&
+        (o_vars.b.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option b)");
     if (o_vars.c.activity.initialized() &&
         (o_vars.c.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option c)");
+    if (o_vars.c.chb.initialized() &&
+        (o_vars.c.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option c)");
+    if (o_vars.c.wdeg.initialized() &&
+        (o_vars.c.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option c)");
+    if (o_vars.c.impact.initialized() &&
+        (o_vars.c.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option c)");
     if (o_vars.d.activity.initialized() &&
         (o_vars.d.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option d)");
+    if (o_vars.d.chb.initialized() &&
+        (o_vars.d.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option d)");
+    if (o_vars.d.wdeg.initialized() &&
+        (o_vars.d.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option d)");
+    if (o_vars.d.impact.initialized() &&
+        (o_vars.d.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option d)");
     ViewArray<IntView> xv(home,x);
     Gecode::ViewSelVirtualBase<IntView>* tb[3];
     int n=0;
@@ -338,7 +455,7 @@ namespace Gecode {
         ByMinMin va(home,o_vars.a);
         ViewSelTieBreakStatic<ByMinMin,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_MIN_MAX:
@@ -346,7 +463,7 @@ namespace Gecode {
         ByMinMax va(home,o_vars.a);
         ViewSelTieBreakStatic<ByMinMax,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_MAX_MIN:
@@ -354,7 +471,7 @@ namespace Gecode {
         ByMaxMin va(home,o_vars.a);
         ViewSelTieBreakStatic<ByMaxMin,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_MAX_MAX:
@@ -362,7 +479,7 @@ namespace Gecode {
         ByMaxMax va(home,o_vars.a);
         ViewSelTieBreakStatic<ByMaxMax,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_MIN:
@@ -370,7 +487,7 @@ namespace Gecode {
         BySizeMin va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeMin,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_MAX:
@@ -378,7 +495,7 @@ namespace Gecode {
         BySizeMax va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeMax,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_DEGREE_MIN:
@@ -386,7 +503,7 @@ namespace Gecode {
         ViewSelDegreeMin<IntView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelDegreeMin<IntView>,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_DEGREE_MAX:
@@ -394,7 +511,7 @@ namespace Gecode {
         ViewSelDegreeMax<IntView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelDegreeMax<IntView>,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_AFC_MIN:
@@ -402,7 +519,7 @@ namespace Gecode {
         ViewSelAfcMin<IntView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelAfcMin<IntView>,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_AFC_MAX:
@@ -410,7 +527,7 @@ namespace Gecode {
         ViewSelAfcMax<IntView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelAfcMax<IntView>,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_ACTIVITY_MIN:
@@ -418,7 +535,7 @@ namespace Gecode {
         ViewSelActivityMin<IntView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelActivityMin<IntView>,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_ACTIVITY_MAX:
@@ -426,7 +543,55 @@ namespace Gecode {
         ViewSelActivityMax<IntView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelActivityMax<IntView>,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_CHB_MIN:
+      {
+        ViewSelCHBMin<IntView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelCHBMin<IntView>,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_CHB_MAX:
+      {
+        ViewSelCHBMax<IntView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelCHBMax<IntView>,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_WDEG_MIN:
+      {
+        ViewSelWDegMin<IntView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelWDegMin<IntView>,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_WDEG_MAX:
+      {
+        ViewSelWDegMax<IntView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelWDegMax<IntView>,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_IMPACT_MIN:
+      {
+        ByImpactMin<IntView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ByImpactMin<IntView>,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_IMPACT_MAX:
+      {
+        ByImpactMax<IntView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ByImpactMax<IntView>,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_DEGREE_MIN:
@@ -434,7 +599,7 @@ namespace Gecode {
         BySizeDegreeMin va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeDegreeMin,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_DEGREE_MAX:
@@ -442,7 +607,7 @@ namespace Gecode {
         BySizeDegreeMax va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeDegreeMax,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_AFC_MIN:
@@ -450,7 +615,7 @@ namespace Gecode {
         BySizeAfcMin va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeAfcMin,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_AFC_MAX:
@@ -458,7 +623,7 @@ namespace Gecode {
         BySizeAfcMax va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeAfcMax,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_ACTIVITY_MIN:
@@ -466,7 +631,7 @@ namespace Gecode {
         BySizeActivityMin va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeActivityMin,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_SIZE_ACTIVITY_MAX:
@@ -474,7 +639,23 @@ namespace Gecode {
         BySizeActivityMax va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeActivityMax,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_SIZE_WDEG_MIN:
+      {
+        BySizeWDegMin va(home,o_vars.a);
+        ViewSelTieBreakStatic<BySizeWDegMin,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case INT_VAR_SIZE_WDEG_MAX:
+      {
+        BySizeWDegMax va(home,o_vars.a);
+        ViewSelTieBreakStatic<BySizeWDegMax,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_REGRET_MIN_MIN:
@@ -482,7 +663,7 @@ namespace Gecode {
         ByRegretMinMin va(home,o_vars.a);
         ViewSelTieBreakStatic<ByRegretMinMin,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_REGRET_MIN_MAX:
@@ -490,7 +671,7 @@ namespace Gecode {
         ByRegretMinMax va(home,o_vars.a);
         ViewSelTieBreakStatic<ByRegretMinMax,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_REGRET_MAX_MIN:
@@ -498,7 +679,7 @@ namespace Gecode {
         ByRegretMaxMin va(home,o_vars.a);
         ViewSelTieBreakStatic<ByRegretMaxMin,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case INT_VAR_REGRET_MAX_MAX:
@@ -506,7 +687,7 @@ namespace Gecode {
         ByRegretMaxMax va(home,o_vars.a);
         ViewSelTieBreakStatic<ByRegretMaxMax,
           ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     default:
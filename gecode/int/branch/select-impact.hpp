@@ -0,0 +1,153 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Int { namespace Branch {
+
+  template<class ViewSel>
+  forceinline
+  ViewImpactBrancher<ViewSel>::
+  ViewImpactBrancher(Home home, ViewArray<View>& x,
+                     ViewSel& vi_s, const Impact& impact0, BranchFilter bf)
+    : ViewBrancher<ViewSel>(home,x,vi_s,bf), impact(impact0) {
+    if (!viewsel.notice())
+      home.notice(*this,AP_DISPOSE);
+  }
+
+  template<class ViewSel>
+  void
+  ViewImpactBrancher<ViewSel>::
+  post(Home home, ViewArray<View>& x, ViewSel& vi_s, const Impact& impact,
+       BranchFilter bf) {
+    (void) new (home) ViewImpactBrancher<ViewSel>(home,x,vi_s,impact,bf);
+  }
+
+  template<class ViewSel>
+  forceinline
+  ViewImpactBrancher<ViewSel>::
+  ViewImpactBrancher(Space& home, bool share, ViewImpactBrancher& b)
+    : ViewBrancher<ViewSel>(home,share,b) {
+    impact.update(home,share,b.impact);
+  }
+
+  template<class ViewSel>
+  Actor*
+  ViewImpactBrancher<ViewSel>::copy(Space& home, bool share) {
+    return new (home)
+      ViewImpactBrancher<ViewSel>(home,share,*this);
+  }
+
+  template<class ViewSel>
+  void
+  ViewImpactBrancher<ViewSel>::probe(Space& home) {
+    typename ViewSel::Choice viewc(viewsel.choice(home));
+    for (int i=0; i<x.size(); i++) {
+      typename View::VarType y(x[i].varimp());
+      if (x[i].assigned() || ((bf != NULL) && !bf(home,i,y)))
+        continue;
+      for (ViewValues<View> n(x[i]); n(); ++n) {
+        PosValChoice<ViewSel,ValSelBase<View,int> > 
+          pvc(*this,i,viewc,EmptyValSelChoice(),n.val());
+        Space* c = home.clone();
+        c->commit(pvc,0);
+        (void) c->status();
+        delete c;
+      }
+    }
+  }
+
+  template<class ViewSel>
+  const Choice*
+  ViewImpactBrancher<ViewSel>::choice(Space& home) {
+    if (impact.probe())
+      probe(home);
+    Pos p = ViewBrancher<ViewSel>::pos(home);
+    View x(ViewBrancher<ViewSel>::view(p).varimp());
+    // Select value with smallest impact
+    int v = x.min();
+    double m = impact(p.pos,v);
+    for (ViewValues<View> n(x); n(); ++n)
+      if (impact(p.pos,n.val()) < m) {
+        v = n.val(); m = impact(p.pos,v);
+      }
+    return new PosValChoice<ViewSel,ValSelBase<View,int> >
+      (*this,p,viewsel.choice(home),EmptyValSelChoice(),v);
+  }
+
+  template<class ViewSel>
+  const Choice*
+  ViewImpactBrancher<ViewSel>::choice(const Space& home, Archive& e) {
+    int p; e >> p;
+    typename ViewSel::Choice viewsc = viewsel.choice(home,e);
+    int v; e >> v;
+    return new PosValChoice<ViewSel,ValSelBase<View,int> >
+      (*this,p,viewsc,EmptyValSelChoice(),v);
+  }
+
+  template<class ViewSel>
+  ExecStatus
+  ViewImpactBrancher<ViewSel>
+  ::commit(Space& home, const Choice& c, unsigned int a) {
+    const PosValChoice<ViewSel,ValSelBase<View,int> >& pvc
+      = static_cast<const PosValChoice<ViewSel,ValSelBase<View,int> >&>(c);
+    int i = pvc.pos().pos;
+    int v = pvc.val();
+    viewsel.commit(home, pvc.viewchoice(), a);
+    if (a == 1)
+      return me_failed(x[i].nq(home,v)) ? ES_FAILED : ES_OK;
+    // The observer must be created before the assignment is performed
+    impact.observe(home,x,i,v);
+    if (me_failed(x[i].eq(home,v))) {
+      impact.update(i,v,1.0);
+      return ES_FAILED;
+    }
+    return ES_OK;
+  }
+
+  template<class ViewSel>
+  forceinline size_t
+  ViewImpactBrancher<ViewSel>::dispose(Space& home) {
+    if (!viewsel.notice())
+      home.ignore(*this,AP_DISPOSE);
+    impact.~Impact();
+    (void) ViewBrancher<ViewSel>::dispose(home);
+    return sizeof(ViewImpactBrancher<ViewSel>);
+  }
+
+}}}
+
+// STATISTICS: int-branch
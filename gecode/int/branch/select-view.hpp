@@ -347,6 +347,188 @@ namespace Gecode { namespace Int { namespace Branch {
     activity.~Activity();
   }
 
+  // Select variable with smallest size/weighted degree
+  forceinline
+  BySizeWDegMin::BySizeWDegMin(void) : sizewdeg(0.0) {}
+  forceinline
+  BySizeWDegMin::BySizeWDegMin(Space& home,
+                               const VarBranchOptions& vbo)
+    : ViewSelBase<IntView>(home,vbo), wdeg(vbo.wdeg), sizewdeg(0.0) {
+    if (!wdeg.initialized())
+      throw MissingWDeg("BySizeWDegMin (INT_VAR_SIZE_WDEG_MIN)");
+  }
+  forceinline ViewSelStatus
+  BySizeWDegMin::init(Space&, View x, int i) {
+    sizewdeg = static_cast<double>(x.size())/wdeg[i];
+    return VSS_BETTER;
+  }
+  forceinline ViewSelStatus
+  BySizeWDegMin::select(Space&, View x, int i) {
+    double sa = static_cast<double>(x.size())/wdeg[i];
+    if (sa < sizewdeg) {
+      sizewdeg = sa;
+      return VSS_BETTER;
+    } else if (sa > sizewdeg) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+  forceinline void
+  BySizeWDegMin::update(Space& home, bool share, BySizeWDegMin& vs) {
+    wdeg.update(home, share, vs.wdeg);
+  }
+  forceinline bool
+  BySizeWDegMin::notice(void) const {
+    return true;
+  }
+  forceinline void
+  BySizeWDegMin::dispose(Space&) {
+    wdeg.~WDeg();
+  }
+
+  // Select variable with largest size/weighted degree
+  forceinline
+  BySizeWDegMax::BySizeWDegMax(void) : sizewdeg(0.0) {}
+  forceinline
+  BySizeWDegMax::BySizeWDegMax(Space& home,
+                               const VarBranchOptions& vbo)
+    : ViewSelBase<IntView>(home,vbo), wdeg(vbo.wdeg), sizewdeg(0.0) {
+    if (!wdeg.initialized())
+      throw MissingWDeg("BySizeWDegMax (INT_VAR_SIZE_WDEG_MAX)");
+  }
+  forceinline ViewSelStatus
+  BySizeWDegMax::init(Space&, View x, int i) {
+    sizewdeg = static_cast<double>(x.size())/wdeg[i];
+    return VSS_BETTER;
+  }
+  forceinline ViewSelStatus
+  BySizeWDegMax::select(Space&, View x, int i) {
+    double sa = static_cast<double>(x.size())/wdeg[i];
+    if (sa > sizewdeg) {
+      sizewdeg = sa;
+      return VSS_BETTER;
+    } else if (sa < sizewdeg) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+  forceinline void
+  BySizeWDegMax::update(Space& home, bool share, BySizeWDegMax& vs) {
+    wdeg.update(home, share, vs.wdeg);
+  }
+  forceinline bool
+  BySizeWDegMax::notice(void) const {
+    return true;
+  }
+  forceinline void
+  BySizeWDegMax::dispose(Space&) {
+    wdeg.~WDeg();
+  }
+
+  // Return average impact of the values of view x at position i
+  template<class View>
+  forceinline double
+  impact(const Impact& im, View x, int i) {
+    double s = 0.0;
+    for (ViewValues<View> n(x); n(); ++n)
+      s += im(i,n.val());
+    return s / x.size();
+  }
+
+  // Select variable with smallest average impact
+  template<class View>
+  forceinline
+  ByImpactMin<View>::ByImpactMin(void) : imp(0.0) {}
+  template<class View>
+  forceinline
+  ByImpactMin<View>::ByImpactMin(Space& home, const VarBranchOptions& vbo)
+    : ViewSelBase<View>(home,vbo), impact(vbo.impact), imp(0.0) {
+    if (!impact.initialized())
+      throw MissingImpact("ByImpactMin (INT_VAR_IMPACT_MIN)");
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ByImpactMin<View>::init(Space&, View x, int i) {
+    imp = Branch::impact(impact,x,i);
+    return VSS_BETTER;
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ByImpactMin<View>::select(Space&, View x, int i) {
+    double m = Branch::impact(impact,x,i);
+    if (m < imp) {
+      imp = m;
+      return VSS_BETTER;
+    } else if (m > imp) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+  template<class View>
+  forceinline void
+  ByImpactMin<View>::update(Space& home, bool share, ByImpactMin& vs) {
+    impact.update(home, share, vs.impact);
+  }
+  template<class View>
+  forceinline bool
+  ByImpactMin<View>::notice(void) const {
+    return true;
+  }
+  template<class View>
+  forceinline void
+  ByImpactMin<View>::dispose(Space&) {
+    impact.~Impact();
+  }
+
+  // Select variable with largest average impact
+  template<class View>
+  forceinline
+  ByImpactMax<View>::ByImpactMax(void) : imp(0.0) {}
+  template<class View>
+  forceinline
+  ByImpactMax<View>::ByImpactMax(Space& home, const VarBranchOptions& vbo)
+    : ViewSelBase<View>(home,vbo), impact(vbo.impact), imp(0.0) {
+    if (!impact.initialized())
+      throw MissingImpact("ByImpactMax (INT_VAR_IMPACT_MAX)");
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ByImpactMax<View>::init(Space&, View x, int i) {
+    imp = Branch::impact(impact,x,i);
+    return VSS_BETTER;
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ByImpactMax<View>::select(Space&, View x, int i) {
+    double m = Branch::impact(impact,x,i);
+    if (m > imp) {
+      imp = m;
+      return VSS_BETTER;
+    } else if (m < imp) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+  template<class View>
+  forceinline void
+  ByImpactMax<View>::update(Space& home, bool share, ByImpactMax& vs) {
+    impact.update(home, share, vs.impact);
+  }
+  template<class View>
+  forceinline bool
+  ByImpactMax<View>::notice(void) const {
+    return true;
+  }
+  template<class View>
+  forceinline void
+  ByImpactMax<View>::dispose(Space&) {
+    impact.~Impact();
+  }
+
   // Select variable with smallest min-regret
   forceinline
   ByRegretMinMin::ByRegretMinMin(void) : regret(0U) {}
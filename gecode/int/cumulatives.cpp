@@ -96,9 +96,7 @@ namespace Gecode {
         vs    = make_view_array(home, s),
         ve    = make_view_array(home, e);
 
-      SharedArray<int> c_s(c.size());
-      for (int i=c.size(); i--;)
-        c_s[i] = c[i];
+      ImmutableArray<int> c_s(c);
 
       // There is only the value-consistent propagator for this constraint
       GECODE_ES_FAIL((Int::Cumulatives::Val<
@@ -94,13 +94,13 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     ViewArray<ViewP>  p;
     ViewArray<View>   e;
     ViewArray<ViewU>  u;
-    SharedArray<int>  c;
+    ImmutableArray<int> c;
     const bool        at_most;
 
     Val(Space& home, bool share, Val<ViewM, ViewP, ViewU, View>& p);
     Val(Home home, const ViewArray<ViewM>&, const ViewArray<View>&,
         const ViewArray<ViewP>&, const ViewArray<View>&,
-        const ViewArray<ViewU>&, const SharedArray<int>&, bool);
+        const ViewArray<ViewU>&, const ImmutableArray<int>&, bool);
 
     ExecStatus prune(Space& home, int low, int up, int r,
                      int ntask, int su,
@@ -117,7 +117,7 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     static ExecStatus post(Home home, const ViewArray<ViewM>&,
                            const ViewArray<View>&, const ViewArray<ViewP>&,
                            const ViewArray<View>&, const ViewArray<ViewU>&,
-                           const SharedArray<int>&, bool);
+                           const ImmutableArray<int>&, bool);
     /// Dispose propagator
     virtual size_t dispose(Space& home);
   };
@@ -54,7 +54,7 @@ namespace Gecode { namespace Int { namespace Cumulatives {
                                    const ViewArray<ViewP>& _p,
                                    const ViewArray<View>& _e,
                                    const ViewArray<ViewU>& _u,
-                                   const SharedArray<int>& _c,
+                                   const ImmutableArray<int>& _c,
                                    bool _at_most) :
     Propagator(home),
     m(_m), s(_s), p(_p), e(_e), u(_u), c(_c), at_most(_at_most) {
@@ -73,7 +73,7 @@ namespace Gecode { namespace Int { namespace Cumulatives {
   ::post(Home home, const ViewArray<ViewM>& m,
          const ViewArray<View>& s, const ViewArray<ViewP>& p,
          const ViewArray<View>& e, const ViewArray<ViewU>& u,
-         const SharedArray<int>& c, bool at_most) {
+         const ImmutableArray<int>& c, bool at_most) {
     (void) new (home) Val(home, m,s,p,e,u,c,at_most);
     return ES_OK;
   }
@@ -102,7 +102,7 @@ namespace Gecode { namespace Int { namespace Cumulatives {
       e.cancel(home,*this,Int::PC_INT_BND);
       u.cancel(home,*this,Int::PC_INT_BND);
     }
-    c.~SharedArray();
+    c.~ImmutableArray<int>();
     (void) Propagator::dispose(home);
     return sizeof(*this);
   }
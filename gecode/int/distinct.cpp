@@ -48,16 +48,35 @@ namespace Gecode {
     if (x.same(home))
       throw ArgumentSame("Int::distinct");
     if (home.failed()) return;
-    ViewArray<IntView> xv(home,x);
+    // Domain consistency implies bounds consistency implies value propagation
+    Region r(home);
+    Signature v(r,"Int::Distinct::Val<IntView>");
+    Signature b(r,"Int::Distinct::Bnd<IntView>");
+    Signature d(r,"Int::Distinct::Dom<IntView>");
+    for (int i=x.size(); i--; ) {
+      v << x[i].varimp(); b << x[i].varimp(); d << x[i].varimp();
+    }
+    v.sort(); b.sort(); d.sort();
     switch (icl) {
     case ICL_BND:
-      GECODE_ES_FAIL(Distinct::Bnd<IntView>::post(home,xv));
+      if (!home.identical(b)) {
+        home.implied(v);
+        ViewArray<IntView> xv(home,x);
+        GECODE_ES_FAIL(Distinct::Bnd<IntView>::post(home,xv));
+      }
       break;
     case ICL_DOM:
-      GECODE_ES_FAIL(Distinct::Dom<IntView>::post(home,xv));
+      if (!home.identical(d)) {
+        home.implied(b); home.implied(v);
+        ViewArray<IntView> xv(home,x);
+        GECODE_ES_FAIL(Distinct::Dom<IntView>::post(home,xv));
+      }
       break;
     default:
-      GECODE_ES_FAIL(Distinct::Val<IntView>::post(home,xv));
+      if (!home.identical(v)) {
+        ViewArray<IntView> xv(home,x);
+        GECODE_ES_FAIL(Distinct::Val<IntView>::post(home,xv));
+      }
     }
   }
 
@@ -76,6 +76,8 @@ namespace Gecode { namespace Int { namespace Distinct {
   public:
     /// Copy propagator during cloning
     virtual Actor*     copy(Space& home, bool share);
+    /// Report solution distribution to \a sd
+    virtual void solndistrib(Space& home, SolnDistribution& sd) const;
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
     /// Post propagator for view array \a x
@@ -98,6 +100,34 @@ namespace Gecode { namespace Int { namespace Distinct {
   template<class View, bool complete>
   ExecStatus prop_val(Space& home, ViewArray<View>&);
 
+  /**
+   * \brief Report solution densities for views \a x to \a sd
+   *
+   * The views \a x can take values between \a min and \a max and
+   * a value \a v can be taken by at most \a cap[v-min] views. The
+   * densities are estimated from the Bregman-Minc upper bound on the
+   * number of solutions as proposed for counting-based search by
+   * Pesant, Quimper, and Zanarini. The capacities in \a cap are
+   * updated for the values of assigned views.
+   */
+  template<class View>
+  void cbsdensities(Space& home, const ViewArray<View>& x, int min, int max,
+                    int* cap, SolnDistribution& sd);
+
+  /**
+   * \brief Compute smallest value \a min and largest value \a max of the unassigned views \a x
+   *
+   * Returns whether \a sd requires the densities of some unassigned view.
+   */
+  template<class View>
+  bool cbsrange(const ViewArray<View>& x, SolnDistribution& sd,
+                int& min, int& max);
+
+  /// Report solution densities for distinct views \a x to \a sd
+  template<class View>
+  void cbsdistinct(Space& home, const ViewArray<View>& x,
+                   SolnDistribution& sd);
+
 
 
   /**
@@ -154,6 +184,8 @@ namespace Gecode { namespace Int { namespace Distinct {
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home, bool share);
+    /// Report solution distribution to \a sd
+    virtual void solndistrib(Space& home, SolnDistribution& sd) const;
     /// Destructor
     virtual size_t dispose(Space& home);
   };
@@ -269,6 +301,8 @@ namespace Gecode { namespace Int { namespace Distinct {
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home, bool share);
+    /// Report solution distribution to \a sd
+    virtual void solndistrib(Space& home, SolnDistribution& sd) const;
     /// Post propagator for views \a x
     static ExecStatus post(Home home, ViewArray<View>& x);
   };
@@ -295,12 +329,15 @@ namespace Gecode { namespace Int { namespace Distinct {
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home, bool share);
+    /// Report solution distribution to \a sd
+    virtual void solndistrib(Space& home, SolnDistribution& sd) const;
     /// Post propagator for views \a x
     static  ExecStatus post(Home home, View x0, View x1, View x2);
   };
 
 }}}
 
+#include <gecode/int/distinct/cbs.hpp>
 #include <gecode/int/distinct/val.hpp>
 #include <gecode/int/distinct/bnd.hpp>
 #include <gecode/int/distinct/ter-dom.hpp>
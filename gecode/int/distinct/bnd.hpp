@@ -77,6 +77,12 @@ namespace Gecode { namespace Int { namespace Distinct {
     return new (home) Bnd<View>(home,share,*this);
   }
 
+  template<class View>
+  void
+  Bnd<View>::solndistrib(Space& home, SolnDistribution& sd) const {
+    cbsdistinct(home,x,sd);
+  }
+
   template<class View>
   PropCost
   Bnd<View>::cost(const Space&, const ModEventDelta& med) const {
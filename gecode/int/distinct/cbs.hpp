@@ -0,0 +1,147 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <cmath>
+
+namespace Gecode { namespace Int { namespace Distinct {
+
+  template<class View>
+  void
+  cbsdensities(Space& home, const ViewArray<View>& x, int min, int max,
+               int* cap, SolnDistribution& sd) {
+    Region r(home);
+    // Take values already used by assigned views into account
+    for (int i=x.size(); i--; )
+      if (x[i].assigned() && (x[i].val() >= min) && (x[i].val() <= max))
+        cap[x[i].val()-min]--;
+    // Number of value copies available to each view
+    unsigned int* d = r.alloc<unsigned int>(x.size());
+    unsigned int m = 0;
+    for (int i=x.size(); i--; ) {
+      d[i] = 0;
+      if (!x[i].assigned()) {
+        for (ViewValues<View> v(x[i]); v(); ++v)
+          if (cap[v.val()-min] > 0)
+            d[i] += static_cast<unsigned int>(cap[v.val()-min]);
+        if (d[i] == 0)
+          return;
+        m = std::max(m,d[i]);
+      }
+    }
+    /*
+     * The Bregman-Minc upper bound on the number of solutions is
+     * the product of (d!)^(1/d) for all views with d value copies,
+     * lf[d] is the logarithm of (d!)^(1/d).
+     */
+    double* lf = r.alloc<double>(m+1);
+    {
+      double l = 0.0;
+      lf[0] = 0.0;
+      for (unsigned int k=1; k<=m; k++) {
+        l += std::log(static_cast<double>(k));
+        lf[k] = l / k;
+      }
+    }
+    int w = max-min+1;
+    // Change of the logarithm of the bound when a value copy is taken
+    double* s = r.alloc<double>(w);
+    // Number of views that would lose their last value copy
+    int* z = r.alloc<int>(w);
+    for (int j=w; j--; ) {
+      s[j] = 0.0; z[j] = 0;
+    }
+    for (int i=x.size(); i--; )
+      if (!x[i].assigned())
+        for (ViewValues<View> v(x[i]); v(); ++v)
+          if (cap[v.val()-min] > 0) {
+            s[v.val()-min] += lf[d[i]-1] - lf[d[i]];
+            if (d[i] == 1)
+              z[v.val()-min]++;
+          }
+    // Report normalized densities
+    for (int i=x.size(); i--; )
+      if (!x[i].assigned() && sd.supports(x[i].varimp())) {
+        int o = (d[i] == 1) ? 1 : 0;
+        double sm = 0.0; bool f = false;
+        for (ViewValues<View> v(x[i]); v(); ++v)
+          if ((cap[v.val()-min] > 0) && (z[v.val()-min] == o) &&
+              (!f || (s[v.val()-min] > sm))) {
+            sm = s[v.val()-min]; f = true;
+          }
+        if (!f)
+          continue;
+        double t = 0.0;
+        for (ViewValues<View> v(x[i]); v(); ++v)
+          if ((cap[v.val()-min] > 0) && (z[v.val()-min] == o))
+            t += cap[v.val()-min] * std::exp(s[v.val()-min]-sm);
+        for (ViewValues<View> v(x[i]); v(); ++v)
+          if ((cap[v.val()-min] > 0) && (z[v.val()-min] == o))
+            sd.marginal(x[i].varimp(),x[i].baseval(v.val()),
+                        cap[v.val()-min] * std::exp(s[v.val()-min]-sm) / t);
+      }
+  }
+
+  template<class View>
+  forceinline bool
+  cbsrange(const ViewArray<View>& x, SolnDistribution& sd,
+           int& min, int& max) {
+    bool s = false;
+    min = Int::Limits::max; max = Int::Limits::min;
+    for (int i=x.size(); i--; )
+      if (!x[i].assigned()) {
+        min = std::min(min,x[i].min()); max = std::max(max,x[i].max());
+        s = s || sd.supports(x[i].varimp());
+      }
+    return s;
+  }
+
+  template<class View>
+  void
+  cbsdistinct(Space& home, const ViewArray<View>& x, SolnDistribution& sd) {
+    int min, max;
+    if (!cbsrange(x,sd,min,max))
+      return;
+    Region r(home);
+    int* cap = r.alloc<int>(max-min+1);
+    for (int j=max-min+1; j--; )
+      cap[j] = 1;
+    cbsdensities(home,x,min,max,cap,sd);
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -79,6 +79,12 @@ namespace Gecode { namespace Int { namespace Distinct {
     return new (home) Dom<View>(home,share,*this);
   }
 
+  template<class View>
+  void
+  Dom<View>::solndistrib(Space& home, SolnDistribution& sd) const {
+    cbsdistinct(home,x,sd);
+  }
+
   template<class View>
   ExecStatus
   Dom<View>::propagate(Space& home, const ModEventDelta& med) {
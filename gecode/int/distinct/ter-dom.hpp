@@ -66,6 +66,15 @@ namespace Gecode { namespace Int { namespace Distinct {
     return new (home) TerDom<View>(home,share,*this);
   }
 
+  template<class View>
+  void
+  TerDom<View>::solndistrib(Space& home, SolnDistribution& sd) const {
+    Region r(home);
+    ViewArray<View> x(r,3);
+    x[0]=x0; x[1]=x1; x[2]=x2;
+    cbsdistinct(home,x,sd);
+  }
+
   /// Check whether x0 forms a Hall set of cardinality one
 #define GECODE_INT_HALL_ONE(x0,x1,x2)           \
   if (x0.assigned()) {                          \
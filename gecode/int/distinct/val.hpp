@@ -162,6 +162,12 @@ namespace Gecode { namespace Int { namespace Distinct {
     return new (home) Val<View>(home,share,*this);
   }
 
+  template<class View>
+  void
+  Val<View>::solndistrib(Space& home, SolnDistribution& sd) const {
+    cbsdistinct(home,x,sd);
+  }
+
   template<class View>
   ExecStatus
   Val<View>::propagate(Space& home, const ModEventDelta&) {
@@ -163,8 +163,8 @@ namespace Gecode { namespace Int { namespace Element {
     typedef typename Gecode::Support::IntTypeTraits<Val>::utype ValSize;
     /// Size of \a x1 at last execution
     ValSize s1;
-    /// Shared array of integer values
-    IntSharedArray c;
+    /// Immutable array of integer values
+    ImmutableArray<int> c;
     /// The index-value data structure
     IdxVal* iv;
     /// Prune index according to \a x0
@@ -172,8 +172,8 @@ namespace Gecode { namespace Int { namespace Element {
     /// Prune values according to \a x1
     void prune_val(void);
     /// Prune when \a x1 is assigned
-    static ExecStatus assigned_val(Space& home, IntSharedArray& c, 
-                                   V0 x0, V1 x1);
+    template<class A>
+    static ExecStatus assigned_val(Space& home, const A& c, V0 x0, V1 x1);
     /// Constructor for cloning \a p
     Int(Space& home, bool shared, Int& p);
     /// Constructor for creation
@@ -172,7 +172,7 @@ namespace Gecode { namespace Int { namespace Element {
     home.ignore(*this,AP_DISPOSE);
     x0.cancel(home,*this,PC_INT_DOM);
     x1.cancel(home,*this,PC_INT_DOM);
-    c.~IntSharedArray();
+    c.~ImmutableArray<int>();
     (void) Propagator::dispose(home);
     return sizeof(*this);
   }
@@ -261,9 +261,9 @@ namespace Gecode { namespace Int { namespace Element {
   }
 
   template<class V0, class V1, class Idx, class Val>
+  template<class A>
   ExecStatus
-  Int<V0,V1,Idx,Val>::assigned_val(Space& home, IntSharedArray& c, 
-                                   V0 x0, V1 x1) {
+  Int<V0,V1,Idx,Val>::assigned_val(Space& home, const A& c, V0 x0, V1 x1) {
     Region r(home);
     int* v = r.alloc<int>(x0.size());
     int n = 0;
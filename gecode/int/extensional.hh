@@ -200,6 +200,8 @@ namespace Gecode { namespace Int { namespace Extensional {
     virtual Actor* copy(Space& home, bool share);
     /// Cost function (defined as high linear)
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Report solution distribution to \a sd
+    virtual void solndistrib(Space& home, SolnDistribution& sd) const;
     /// Give advice to propagator
     virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
     /// Perform propagation
@@ -740,6 +740,87 @@ namespace Gecode { namespace Int { namespace Extensional {
     return PropCost::linear(PropCost::HI,n);
   }
 
+  template<class View, class Val, class Degree, class StateIdx>
+  void
+  LayeredGraph<View,Val,Degree,StateIdx>::solndistrib
+  (Space& home, SolnDistribution& sd) const {
+    // Check whether densities are needed at all
+    {
+      bool s = false;
+      for (int i=n; i--; )
+        if (!layers[i].x.assigned() && sd.supports(layers[i].x.varimp())) {
+          s = true; break;
+        }
+      if (!s)
+        return;
+    }
+    Region r(home);
+    // Offsets of the states of the layers
+    unsigned int* o = r.alloc<unsigned int>(n+2);
+    o[0] = 0;
+    for (int i=0; i<=n; i++)
+      o[i+1] = o[i] + layers[i].n_states;
+    // Number of paths from the first layer and to the last layer
+    double* f = r.alloc<double>(o[n+1]);
+    double* b = r.alloc<double>(o[n+1]);
+    for (unsigned int j=o[n+1]; j--; )
+      f[j] = b[j] = 0.0;
+    for (unsigned int j=o[0]; j<o[1]; j++)
+      f[j] = 1.0;
+    for (unsigned int j=o[n]; j<o[n+1]; j++)
+      b[j] = 1.0;
+    /*
+     * The number of paths is normalized per layer to avoid overflow,
+     * the densities of a layer are independent of the normalization.
+     */
+    for (int i=0; i<n; i++) {
+      double t = 0.0;
+      for (ValSize j=layers[i].size; j--; ) {
+        const Support& s = layers[i].support[j];
+        for (Degree d=s.n_edges; d--; ) {
+          f[o[i+1]+s.edges[d].o_state] += f[o[i]+s.edges[d].i_state];
+          t += f[o[i]+s.edges[d].i_state];
+        }
+      }
+      if (t > 0.0)
+        for (unsigned int j=o[i+1]; j<o[i+2]; j++)
+          f[j] /= t;
+    }
+    for (int i=n; i--; ) {
+      double t = 0.0;
+      for (ValSize j=layers[i].size; j--; ) {
+        const Support& s = layers[i].support[j];
+        for (Degree d=s.n_edges; d--; ) {
+          b[o[i]+s.edges[d].i_state] += b[o[i+1]+s.edges[d].o_state];
+          t += b[o[i+1]+s.edges[d].o_state];
+        }
+      }
+      if (t > 0.0)
+        for (unsigned int j=o[i]; j<o[i+1]; j++)
+          b[j] /= t;
+    }
+    // Report densities
+    for (int i=n; i--; )
+      if (!layers[i].x.assigned() && sd.supports(layers[i].x.varimp())) {
+        double t = 0.0;
+        for (ValSize j=layers[i].size; j--; ) {
+          const Support& s = layers[i].support[j];
+          for (Degree d=s.n_edges; d--; )
+            t += f[o[i]+s.edges[d].i_state] * b[o[i+1]+s.edges[d].o_state];
+        }
+        if (t > 0.0)
+          for (ValSize j=layers[i].size; j--; ) {
+            const Support& s = layers[i].support[j];
+            double v = 0.0;
+            for (Degree d=s.n_edges; d--; )
+              v += f[o[i]+s.edges[d].i_state] * b[o[i+1]+s.edges[d].o_state];
+            sd.marginal(layers[i].x.varimp(),
+                        layers[i].x.baseval(static_cast<int>(s.val)),
+                        v / t);
+          }
+      }
+  }
+
   template<class View, class Val, class Degree, class StateIdx>
   Actor*
   LayeredGraph<View,Val,Degree,StateIdx>::copy(Space& home, bool share) {
@@ -45,6 +45,7 @@
 #define __GECODE_INT_GCC_HH__
 
 #include <gecode/int.hh>
+#include <gecode/int/distinct.hh>
 
 /**
  * \namespace Gecode::Int::GCC
@@ -77,6 +78,8 @@ namespace Gecode { namespace Int { namespace GCC {
   public:
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home, bool share);
+    /// Report solution distribution to \a sd
+    virtual void solndistrib(Space& home, SolnDistribution& sd) const;
     /// Cost funtion returning high linear
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Perform propagation
@@ -193,6 +196,8 @@ namespace Gecode { namespace Int { namespace GCC {
   public:
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home, bool share);
+    /// Report solution distribution to \a sd
+    virtual void solndistrib(Space& home, SolnDistribution& sd) const;
     /// Cost funtion
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Perform propagation
@@ -243,6 +248,8 @@ namespace Gecode { namespace Int { namespace GCC {
   public:
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home, bool share);
+    /// Report solution distribution to \a sd
+    virtual void solndistrib(Space& home, SolnDistribution& sd) const;
     /// Cost function
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Perform propagation
@@ -256,6 +263,7 @@ namespace Gecode { namespace Int { namespace GCC {
 
 }}}
 
+#include <gecode/int/gcc/cbs.hpp>
 #include <gecode/int/gcc/post.hpp>
 #include <gecode/int/gcc/val.hpp>
 #include <gecode/int/gcc/bnd.hpp>
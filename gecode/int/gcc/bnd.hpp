@@ -80,6 +80,12 @@ namespace Gecode { namespace Int { namespace GCC {
     return new (home) Bnd<Card>(home,share,*this);
   }
 
+  template<class Card>
+  void
+  Bnd<Card>::solndistrib(Space& home, SolnDistribution& sd) const {
+    cbsgcc(home,x,k,false,sd);
+  }
+
   template<class Card>
   PropCost
   Bnd<Card>::cost(const Space&,
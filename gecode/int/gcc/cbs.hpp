@@ -0,0 +1,63 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace GCC {
+
+  template<class Card>
+  void
+  cbsgcc(Space& home, const ViewArray<IntView>& x, const ViewArray<Card>& k,
+         bool counted, SolnDistribution& sd) {
+    int min, max;
+    if (!Distinct::cbsrange(x,sd,min,max))
+      return;
+    Region r(home);
+    int* cap = r.alloc<int>(max-min+1);
+    for (int j=max-min+1; j--; )
+      cap[j] = x.size();
+    for (int j=k.size(); j--; )
+      if ((k[j].card() >= min) && (k[j].card() <= max)) {
+        int c = k[j].max();
+        if (counted)
+          c -= k[j].counter();
+        cap[k[j].card()-min] = std::min(c,x.size());
+      }
+    Distinct::cbsdensities(home,x,min,max,cap,sd);
+  }
+
+}}}
+
+// STATISTICS: int-prop
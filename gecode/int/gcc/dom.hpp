@@ -102,6 +102,12 @@ namespace Gecode { namespace Int { namespace GCC {
     return new (home) Dom<Card>(home, share, *this);
   }
 
+  template<class Card>
+  void
+  Dom<Card>::solndistrib(Space& home, SolnDistribution& sd) const {
+    cbsgcc(home,y,k,false,sd);
+  }
+
   template<class Card>
   PropCost
   Dom<Card>::cost(const Space&, const ModEventDelta&) const {
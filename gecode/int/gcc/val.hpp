@@ -74,6 +74,12 @@ namespace Gecode { namespace Int { namespace GCC {
     return new (home) Val<Card>(home,share,*this);
   }
 
+  template<class Card>
+  void
+  Val<Card>::solndistrib(Space& home, SolnDistribution& sd) const {
+    cbsgcc(home,x,k,true,sd);
+  }
+
   template<class Card>
   PropCost
   Val<Card>::cost(const Space&, const ModEventDelta&) const {
@@ -103,24 +103,60 @@ namespace Gecode {
   void
   rel(Home home, IntVar x0, IntRelType irt, IntVar x1, IntConLevel icl) {
     if (home.failed()) return;
+    Region r(home);
     switch (irt) {
     case IRT_EQ:
-      if ((icl == ICL_DOM) || (icl == ICL_DEF)) {
-        GECODE_ES_FAIL((Rel::EqDom<IntView,IntView>::post(home,x0,x1)));
-      } else {
-        GECODE_ES_FAIL((Rel::EqBnd<IntView,IntView>::post(home,x0,x1)));
+      {
+        Signature eb(r,"Int::Rel::EqBnd<IntView,IntView>");
+        eb << x0.varimp() << x1.varimp(); eb.sort();
+        if ((icl == ICL_DOM) || (icl == ICL_DEF)) {
+          Signature ed(r,"Int::Rel::EqDom<IntView,IntView>");
+          ed << x0.varimp() << x1.varimp(); ed.sort();
+          if (!home.identical(ed)) {
+            home.implied(eb);
+            GECODE_ES_FAIL((Rel::EqDom<IntView,IntView>::post(home,x0,x1)));
+          }
+        } else if (!home.identical(eb)) {
+          GECODE_ES_FAIL((Rel::EqBnd<IntView,IntView>::post(home,x0,x1)));
+        }
       }
       break;
     case IRT_NQ:
-      GECODE_ES_FAIL(Rel::Nq<IntView>::post(home,x0,x1)); break;
+      {
+        Signature nq(r,"Int::Rel::Nq<IntView>");
+        nq << x0.varimp() << x1.varimp(); nq.sort();
+        if (!home.identical(nq))
+          GECODE_ES_FAIL(Rel::Nq<IntView>::post(home,x0,x1));
+      }
+      break;
     case IRT_GQ:
       std::swap(x0,x1); // Fall through
     case IRT_LQ:
-      GECODE_ES_FAIL(Rel::Lq<IntView>::post(home,x0,x1)); break;
+      {
+        Signature lq(r,"Int::Rel::Lq<IntView>");
+        lq << x0.varimp() << x1.varimp();
+        if (!home.identical(lq))
+          GECODE_ES_FAIL(Rel::Lq<IntView>::post(home,x0,x1));
+      }
+      break;
     case IRT_GR:
       std::swap(x0,x1); // Fall through
     case IRT_LE:
-      GECODE_ES_FAIL(Rel::Le<IntView>::post(home,x0,x1)); break;
+      {
+        Signature le(r,"Int::Rel::Le<IntView>");
+        le << x0.varimp() << x1.varimp();
+        if (!home.identical(le)) {
+          // Implies both x0 <= x1 and x0 != x1
+          Signature lq(r,"Int::Rel::Lq<IntView>");
+          lq << x0.varimp() << x1.varimp();
+          home.implied(lq);
+          Signature nq(r,"Int::Rel::Nq<IntView>");
+          nq << x0.varimp() << x1.varimp(); nq.sort();
+          home.implied(nq);
+          GECODE_ES_FAIL(Rel::Le<IntView>::post(home,x0,x1));
+        }
+      }
+      break;
     default:
       throw UnknownRelation("Int::rel");
     }
@@ -156,6 +156,8 @@ namespace Gecode { namespace Int {
     int med(void) const;
     /// Return assigned value (only if assigned)
     int val(void) const;
+    /// Return value of underlying variable for view value \a n
+    int baseval(int n) const;
 
     /// Return size (cardinality) of domain
     unsigned int size(void) const;
@@ -447,6 +449,8 @@ namespace Gecode { namespace Int {
     int med(void) const;
     /// Return assigned value (only if assigned)
     int val(void) const;
+    /// Return value of underlying variable for view value \a n
+    int baseval(int n) const;
     
     /// Return size (cardinality) of domain
     unsigned int size(void) const;
@@ -1350,6 +1354,8 @@ namespace Gecode { namespace Int {
     int med(void) const;
     /// Return assigned value (only if assigned)
     int val(void) const;
+    /// Return value of underlying variable for view value \a n
+    int baseval(int n) const;
     
     /// Return size (cardinality) of domain
     unsigned int size(void) const;
@@ -74,6 +74,10 @@ namespace Gecode { namespace Int {
   BoolView::val(void) const {
     return x->val();
   }
+  forceinline int
+  BoolView::baseval(int n) const {
+    return n;
+  }
 
   forceinline unsigned int
   BoolView::size(void) const {
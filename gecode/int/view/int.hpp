@@ -70,6 +70,10 @@ namespace Gecode { namespace Int {
   IntView::val(void) const {
     return x->val();
   }
+  forceinline int
+  IntView::baseval(int n) const {
+    return n;
+  }
 
   forceinline unsigned int
   IntView::size(void) const {
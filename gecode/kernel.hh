@@ -46,6 +46,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <cassert>
+#include <cmath>
 
 #include <gecode/support.hh>
 
@@ -107,6 +108,8 @@
 
 #include <gecode/kernel/memory-config.hpp>
 #include <gecode/kernel/memory-manager.hpp>
+#include <gecode/kernel/trail.hpp>
+#include <gecode/kernel/partition.hpp>
 
 
 /*
@@ -134,6 +137,7 @@
  */
 
 #include <gecode/kernel/region.hpp>
+#include <gecode/kernel/signature.hpp>
 
 
 /*
@@ -159,6 +163,7 @@
 
 #include <gecode/kernel/array.hpp>
 #include <gecode/kernel/shared-array.hpp>
+#include <gecode/kernel/immutable-array.hpp>
 
 
 /*
@@ -169,10 +174,15 @@
 #include <gecode/kernel/propagator.hpp>
 #include <gecode/kernel/advisor.hpp>
 #include <gecode/kernel/activity.hpp>
+#include <gecode/kernel/chb.hpp>
+#include <gecode/kernel/wdeg.hpp>
+#include <gecode/kernel/impact.hpp>
+#include <gecode/kernel/phase.hpp>
 #include <gecode/kernel/branch.hpp>
 #include <gecode/kernel/brancher.hpp>
 #include <gecode/kernel/brancher-view.hpp>
 #include <gecode/kernel/brancher-tiebreak.hpp>
+#include <gecode/kernel/brancher-lastconflict.hpp>
 #include <gecode/kernel/brancher-val.hpp>
 
 
@@ -184,6 +184,9 @@ namespace Gecode {
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Give advice to propagator
     virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Give advice to propagator for several advisors
+    virtual ExecStatus advise_batch(Space& home, Advisor* a[], int n,
+                                    const Delta& d);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
     /// Delete propagator and return its size
@@ -408,6 +411,15 @@ namespace Gecode {
     return ES_NOFIX;
   }
 
+  template<class View>
+  ExecStatus
+  Activity::Recorder<View>::advise_batch(Space&, Advisor* a[], int n,
+                                         const Delta&) {
+    for (int i=n; i--; )
+      static_cast<Idx*>(a[i])->mark();
+    return ES_NOFIX;
+  }
+
   template<class View>
   ExecStatus
   Activity::Recorder<View>::propagate(Space& home, const ModEventDelta&) {
@@ -60,15 +60,29 @@ namespace Gecode {
   public:
     /// Activity information
     Activity activity;
+    /// CHB information
+    CHB chb;
+    /// Weighted degree information
+    WDeg wdeg;
+    /// Impact information
+    Impact impact;
     /// Branch filter function
     BranchFilter bf;
     /// Seed for random variable selection
     unsigned int seed;
+    /// Whether to branch on the view of the last conflict first
+    bool lc;
     /// Default options
     GECODE_KERNEL_EXPORT static const VarBranchOptions def;
     /// Initialize with default values
     VarBranchOptions(Activity a=Activity::def,
                      BranchFilter bf0=NULL);
+    /// Initialize with CHB information \a c
+    VarBranchOptions(CHB c, BranchFilter bf0=NULL);
+    /// Initialize with weighted degree information \a w
+    VarBranchOptions(WDeg w, BranchFilter bf0=NULL);
+    /// Initialize with impact information \a i
+    VarBranchOptions(Impact i, BranchFilter bf0=NULL);
     /// Return object with time-based seed value
     static VarBranchOptions time(Activity a=Activity::def,
                                  BranchFilter bf=NULL);
@@ -81,10 +95,18 @@ namespace Gecode {
   public:
     /// Seed for random value selection
     unsigned int seed;
+    /// Impact information
+    Impact impact;
+    /// Phase information
+    Phase phase;
     /// Default options
     GECODE_KERNEL_EXPORT static const ValBranchOptions def;
     /// Initialize with default values
     ValBranchOptions(void);
+    /// Initialize with impact information \a i
+    ValBranchOptions(Impact i);
+    /// Initialize with phase information \a p
+    ValBranchOptions(Phase p);
     /// Return object with time-based seed value
     static ValBranchOptions time(void);
   };
@@ -171,7 +193,19 @@ namespace Gecode {
   // Variable branch options
   forceinline
   VarBranchOptions::VarBranchOptions(Activity a, BranchFilter bf0) 
-    : activity(a), bf(bf0), seed(0) {}
+    : activity(a), bf(bf0), seed(0), lc(false) {}
+
+  forceinline
+  VarBranchOptions::VarBranchOptions(CHB c, BranchFilter bf0) 
+    : chb(c), bf(bf0), seed(0), lc(false) {}
+
+  forceinline
+  VarBranchOptions::VarBranchOptions(WDeg w, BranchFilter bf0) 
+    : wdeg(w), bf(bf0), seed(0), lc(false) {}
+
+  forceinline
+  VarBranchOptions::VarBranchOptions(Impact i, BranchFilter bf0) 
+    : impact(i), bf(bf0), seed(0), lc(false) {}
 
   forceinline VarBranchOptions
   VarBranchOptions::time(Activity a, BranchFilter bf) {
@@ -184,6 +218,12 @@ namespace Gecode {
   forceinline
   ValBranchOptions::ValBranchOptions(void) : seed(0) {}
 
+  forceinline
+  ValBranchOptions::ValBranchOptions(Impact i) : seed(0), impact(i) {}
+
+  forceinline
+  ValBranchOptions::ValBranchOptions(Phase p) : seed(0), phase(p) {}
+
   forceinline ValBranchOptions
   ValBranchOptions::time(void) {
     ValBranchOptions o; o.seed=static_cast<unsigned int>(::time(NULL));
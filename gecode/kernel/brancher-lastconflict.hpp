@@ -0,0 +1,284 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode {
+
+  /**
+   * \defgroup TaskBranchLastConflict Generic last conflict reasoning for brancher based on view and value selection
+   *
+   * \ingroup TaskBranchViewVal
+   */
+  //@{
+  /**
+   * \brief View selection class for last conflict reasoning
+   *
+   * When an alternative other than the first alternative of a choice
+   * is committed, the previous alternatives have failed and the view
+   * of the choice becomes the conflict view (provided there is no
+   * conflict view yet). As long as the conflict view remains
+   * unassigned, it is selected before any view the view selection
+   * \a ViewSel would select. Once a choice is computed for which the
+   * conflict view is assigned, the conflict view is reset.
+   *
+   * The conflict view is shared among all copies of a brancher, also
+   * among the copies used by the workers of parallel search engines.
+   * Last conflict reasoning is only performed if requested by the
+   * variable branch options, otherwise the view selection \a ViewSel
+   * is used unchanged.
+   */
+  template<class ViewSel>
+  class ViewSelLastConflict {
+  protected:
+    /// Object for storing the conflict view
+    class Storage {
+    public:
+      /// Mutex to synchronize globally shared access
+      Support::Mutex m;
+      /// How many references exist for this object
+      unsigned int use_cnt;
+      /// Position of conflict view (negative if there is none)
+      int pos;
+      /// Initialize
+      Storage(void);
+      /// Allocate memory from heap
+      static void* operator new(size_t s);
+      /// Free memory allocated from heap
+      static void  operator delete(void* p);
+    };
+    /// The underlying view selection
+    ViewSel vs;
+    /// Shared conflict view storage (NULL if not used)
+    Storage* storage;
+    /// Position of conflict view at start of view selection
+    int lc;
+    /// Position of so-far selected view
+    int cur;
+    /// Whether \a vs has already found its best view
+    bool best;
+  public:
+    /// View type
+    typedef typename ViewSel::View View;
+    /// View selection choice
+    class Choice {
+    public:
+      /// Choice of underlying view selection
+      typename ViewSel::Choice c;
+      /// Position of selected view
+      int pos;
+      /// Constructor
+      Choice(const typename ViewSel::Choice& c, int pos);
+      /// Report size occupied
+      size_t size(void) const;
+      /// Archive into \a e
+      void archive(Archive& e) const;
+    };
+    /// Default constructor
+    ViewSelLastConflict(void);
+    /// Constructor for initialization
+    ViewSelLastConflict(Space& home, ViewSel& vs, 
+                        const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, View x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, View x, int i);
+    /// Return choice
+    Choice choice(Space& home);
+    /// Return choice
+    Choice choice(const Space& home, Archive& e);
+    /// Commit to choice
+    void commit(Space& home, const Choice& c, unsigned int a);
+    /// Updating during cloning
+    void update(Space& home, bool share, ViewSelLastConflict& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+  //@}
+
+
+  // Conflict view storage
+  template<class ViewSel>
+  forceinline
+  ViewSelLastConflict<ViewSel>::Storage::Storage(void)
+    : use_cnt(1), pos(-1) {}
+  template<class ViewSel>
+  forceinline void*
+  ViewSelLastConflict<ViewSel>::Storage::operator new(size_t s) {
+    return Gecode::heap.ralloc(s);
+  }
+  template<class ViewSel>
+  forceinline void
+  ViewSelLastConflict<ViewSel>::Storage::operator delete(void* p) {
+    Gecode::heap.rfree(p);
+  }
+
+  // Choice with position
+  template<class ViewSel>
+  forceinline
+  ViewSelLastConflict<ViewSel>::Choice
+  ::Choice(const typename ViewSel::Choice& c0, int pos0)
+    : c(c0), pos(pos0) {}
+  template<class ViewSel>
+  forceinline size_t
+  ViewSelLastConflict<ViewSel>::Choice::size(void) const {
+    return c.size() + sizeof(int);
+  }
+  template<class ViewSel>
+  forceinline void
+  ViewSelLastConflict<ViewSel>::Choice::archive(Archive& e) const {
+    c.archive(e);
+    e << pos;
+  }
+
+  // View selection with last conflict reasoning
+  template<class ViewSel>
+  forceinline
+  ViewSelLastConflict<ViewSel>::ViewSelLastConflict(void)
+    : storage(NULL), lc(-1), cur(-1), best(false) {}
+  template<class ViewSel>
+  forceinline
+  ViewSelLastConflict<ViewSel>::
+  ViewSelLastConflict(Space&, ViewSel& vs0, const VarBranchOptions& vbo)
+    : vs(vs0), storage(vbo.lc ? new Storage : NULL), 
+      lc(-1), cur(-1), best(false) {}
+  template<class ViewSel>
+  forceinline ViewSelStatus
+  ViewSelLastConflict<ViewSel>::init(Space& home, View x, int i) {
+    cur = i;
+    if (storage == NULL)
+      return vs.init(home,x,i);
+    storage->m.acquire();
+    lc = storage->pos;
+    storage->m.release();
+    if (i == lc)
+      return VSS_BEST;
+    ViewSelStatus s = vs.init(home,x,i);
+    // Continue looking for the conflict view
+    best = (s == VSS_BEST) && (lc > i);
+    return best ? VSS_BETTER : s;
+  }
+  template<class ViewSel>
+  forceinline ViewSelStatus
+  ViewSelLastConflict<ViewSel>::select(Space& home, View x, int i) {
+    if (i == lc) {
+      cur = i; return VSS_BEST;
+    }
+    if (best)
+      return VSS_WORSE;
+    ViewSelStatus s = vs.select(home,x,i);
+    switch (s) {
+    case VSS_BEST:
+      cur = i;
+      if (lc > i) {
+        best = true; return VSS_BETTER;
+      }
+      break;
+    case VSS_BETTER:
+      cur = i; break;
+    default: ;
+    }
+    return s;
+  }
+  template<class ViewSel>
+  forceinline typename ViewSelLastConflict<ViewSel>::Choice
+  ViewSelLastConflict<ViewSel>::choice(Space& home) {
+    if ((storage != NULL) && (lc >= 0) && (cur != lc)) {
+      // The conflict view has been assigned without failure
+      storage->m.acquire();
+      if (storage->pos == lc)
+        storage->pos = -1;
+      storage->m.release();
+    }
+    lc = -1; best = false;
+    Choice c(vs.choice(home),cur);
+    return c;
+  }
+  template<class ViewSel>
+  forceinline typename ViewSelLastConflict<ViewSel>::Choice
+  ViewSelLastConflict<ViewSel>::choice(const Space& home, Archive& e) {
+    typename ViewSel::Choice c = vs.choice(home,e);
+    int pos; e >> pos;
+    return Choice(c,pos);
+  }
+  template<class ViewSel>
+  forceinline void
+  ViewSelLastConflict<ViewSel>::commit(Space& home, const Choice& c,
+                                       unsigned int a) {
+    vs.commit(home,c.c,a);
+    if ((storage != NULL) && (a > 0)) {
+      storage->m.acquire();
+      if (storage->pos < 0)
+        storage->pos = c.pos;
+      storage->m.release();
+    }
+  }
+  template<class ViewSel>
+  forceinline void
+  ViewSelLastConflict<ViewSel>::update(Space& home, bool share,
+                                       ViewSelLastConflict<ViewSel>& s) {
+    vs.update(home,share,s.vs);
+    storage = s.storage;
+    if (storage != NULL) {
+      storage->m.acquire();
+      storage->use_cnt++;
+      storage->m.release();
+    }
+  }
+  template<class ViewSel>
+  forceinline bool
+  ViewSelLastConflict<ViewSel>::notice(void) const {
+    return (storage != NULL) || vs.notice();
+  }
+  template<class ViewSel>
+  forceinline void
+  ViewSelLastConflict<ViewSel>::dispose(Space& home) {
+    vs.dispose(home);
+    if (storage != NULL) {
+      bool done;
+      storage->m.acquire();
+      done = (--storage->use_cnt == 0);
+      storage->m.release();
+      if (done)
+        delete storage;
+    }
+  }
+
+}
+
+// STATISTICS: kernel-branch
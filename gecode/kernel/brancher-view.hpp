@@ -226,6 +226,114 @@ namespace Gecode {
     void dispose(Space& home);
   };
 
+  /**
+   * \brief View selection class for view with lowest CHB Q-score
+   */
+  template<class View>
+  class ViewSelCHBMin : public ViewSelBase<View> {
+  protected:
+    /// CHB information
+    CHB chb;
+    /// So-far lowest Q-score
+    double a;
+  public:
+    /// Default constructor
+    ViewSelCHBMin(void);
+    /// Constructor for initialization
+    ViewSelCHBMin(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, View x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, View x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, ViewSelCHBMin& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
+  /**
+   * \brief View selection class for view with highest CHB Q-score
+   */
+  template<class View>
+  class ViewSelCHBMax : public ViewSelBase<View> {
+  protected:
+    /// CHB information
+    CHB chb;
+    /// So-far highest Q-score
+    double a;
+  public:
+    /// Default constructor
+    ViewSelCHBMax(void);
+    /// Constructor for initialization
+    ViewSelCHBMax(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, View x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, View x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, ViewSelCHBMax& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
+  /**
+   * \brief View selection class for view with smallest weighted degree
+   */
+  template<class View>
+  class ViewSelWDegMin : public ViewSelBase<View> {
+  protected:
+    /// Weighted degree information
+    WDeg wdeg;
+    /// So-far smallest weight
+    double a;
+  public:
+    /// Default constructor
+    ViewSelWDegMin(void);
+    /// Constructor for initialization
+    ViewSelWDegMin(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, View x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, View x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, ViewSelWDegMin& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
+  /**
+   * \brief View selection class for view with largest weighted degree
+   */
+  template<class View>
+  class ViewSelWDegMax : public ViewSelBase<View> {
+  protected:
+    /// Weighted degree information
+    WDeg wdeg;
+    /// So-far largest weight
+    double a;
+  public:
+    /// Default constructor
+    ViewSelWDegMax(void);
+    /// Constructor for initialization
+    ViewSelWDegMax(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, View x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, View x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, ViewSelWDegMax& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
   /// Random generator with archiving (to be used in branchers)
   class ArchivedRandomGenerator : public Support::RandomGenerator {
   public:
@@ -551,6 +659,196 @@ namespace Gecode {
   }
 
 
+  // Select variable with lowest CHB Q-score
+  template<class View>
+  forceinline
+  ViewSelCHBMin<View>::ViewSelCHBMin(void) : a(0.0) {}
+  template<class View>
+  forceinline
+  ViewSelCHBMin<View>::ViewSelCHBMin(Space& home,
+                                     const VarBranchOptions& vbo)
+    : ViewSelBase<View>(home,vbo), chb(vbo.chb), a(0.0) {
+    if (!chb.initialized())
+      throw MissingCHB("ViewSelCHBMin (VAR_CHB_MIN)");
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelCHBMin<View>::init(Space&, View, int i) {
+    a = chb[i];
+    return VSS_BETTER;
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelCHBMin<View>::select(Space&, View, int i) {
+    if (chb[i] < a) {
+      a = chb[i];
+      return VSS_BETTER;
+    } else if (chb[i] > a) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+  template<class View>
+  forceinline void
+  ViewSelCHBMin<View>::update(Space& home, bool share, 
+                                   ViewSelCHBMin<View>& vs) {
+    chb.update(home, share, vs.chb);
+  }
+  template<class View>
+  forceinline bool
+  ViewSelCHBMin<View>::notice(void) const {
+    return true;
+  }
+  template<class View>
+  forceinline void
+  ViewSelCHBMin<View>::dispose(Space&) {
+    chb.~CHB();
+  }
+
+  // Select variable with highest CHB Q-score
+  template<class View>
+  forceinline
+  ViewSelCHBMax<View>::ViewSelCHBMax(void) : a(0.0) {}
+  template<class View>
+  forceinline
+  ViewSelCHBMax<View>::ViewSelCHBMax(Space& home,
+                                     const VarBranchOptions& vbo)
+    : ViewSelBase<View>(home,vbo), chb(vbo.chb), a(0.0) {
+    if (!chb.initialized())
+      throw MissingCHB("ViewSelCHBMax (VAR_CHB_MAX)");
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelCHBMax<View>::init(Space&, View, int i) {
+    a = chb[i];
+    return VSS_BETTER;
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelCHBMax<View>::select(Space&, View, int i) {
+    if (chb[i] > a) {
+      a = chb[i];
+      return VSS_BETTER;
+    } else if (chb[i] < a) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+  template<class View>
+  forceinline void
+  ViewSelCHBMax<View>::update(Space& home, bool share, 
+                                   ViewSelCHBMax<View>& vs) {
+    chb.update(home, share, vs.chb);
+  }
+  template<class View>
+  forceinline bool
+  ViewSelCHBMax<View>::notice(void) const {
+    return true;
+  }
+  template<class View>
+  forceinline void
+  ViewSelCHBMax<View>::dispose(Space&) {
+    chb.~CHB();
+  }
+
+
+  // Select variable with smallest weighted degree
+  template<class View>
+  forceinline
+  ViewSelWDegMin<View>::ViewSelWDegMin(void) : a(0.0) {}
+  template<class View>
+  forceinline
+  ViewSelWDegMin<View>::ViewSelWDegMin(Space& home,
+                                       const VarBranchOptions& vbo)
+    : ViewSelBase<View>(home,vbo), wdeg(vbo.wdeg), a(0.0) {
+    if (!wdeg.initialized())
+      throw MissingWDeg("ViewSelWDegMin (VAR_WDEG_MIN)");
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelWDegMin<View>::init(Space&, View, int i) {
+    a = wdeg[i];
+    return VSS_BETTER;
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelWDegMin<View>::select(Space&, View, int i) {
+    if (wdeg[i] < a) {
+      a = wdeg[i];
+      return VSS_BETTER;
+    } else if (wdeg[i] > a) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+  template<class View>
+  forceinline void
+  ViewSelWDegMin<View>::update(Space& home, bool share, 
+                                   ViewSelWDegMin<View>& vs) {
+    wdeg.update(home, share, vs.wdeg);
+  }
+  template<class View>
+  forceinline bool
+  ViewSelWDegMin<View>::notice(void) const {
+    return true;
+  }
+  template<class View>
+  forceinline void
+  ViewSelWDegMin<View>::dispose(Space&) {
+    wdeg.~WDeg();
+  }
+
+  // Select variable with largest weighted degree
+  template<class View>
+  forceinline
+  ViewSelWDegMax<View>::ViewSelWDegMax(void) : a(0.0) {}
+  template<class View>
+  forceinline
+  ViewSelWDegMax<View>::ViewSelWDegMax(Space& home,
+                                       const VarBranchOptions& vbo)
+    : ViewSelBase<View>(home,vbo), wdeg(vbo.wdeg), a(0.0) {
+    if (!wdeg.initialized())
+      throw MissingWDeg("ViewSelWDegMax (VAR_WDEG_MAX)");
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelWDegMax<View>::init(Space&, View, int i) {
+    a = wdeg[i];
+    return VSS_BETTER;
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelWDegMax<View>::select(Space&, View, int i) {
+    if (wdeg[i] > a) {
+      a = wdeg[i];
+      return VSS_BETTER;
+    } else if (wdeg[i] < a) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+  template<class View>
+  forceinline void
+  ViewSelWDegMax<View>::update(Space& home, bool share, 
+                                   ViewSelWDegMax<View>& vs) {
+    wdeg.update(home, share, vs.wdeg);
+  }
+  template<class View>
+  forceinline bool
+  ViewSelWDegMax<View>::notice(void) const {
+    return true;
+  }
+  template<class View>
+  forceinline void
+  ViewSelWDegMax<View>::dispose(Space&) {
+    wdeg.~WDeg();
+  }
+
+
   // Archived random generator
   forceinline
   ArchivedRandomGenerator::ArchivedRandomGenerator(void) {}
@@ -0,0 +1,479 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  /**
+   * \brief Class for conflict history-based (CHB) information
+   *
+   * For each variable, a Q-score is maintained. Whenever the domain
+   * of a variable changes, its Q-score is moved towards a reward
+   * that is larger the more recently the variable has been involved
+   * in a failure. Changes that lead to failure are rewarded more than
+   * changes that do not. The step size for moving towards the reward
+   * decreases with the number of failures.
+   *
+   */
+  class CHB {
+  protected:
+    template<class View>
+    class Recorder;
+    /// Object for storing CHB information
+    class Storage {
+    public:
+      /// Mutex to synchronize globally shared access
+      Support::Mutex m;
+      /// How many references exist for this object
+      unsigned int use_cnt;
+      /// Q-scores
+      double* q;
+      /// Number of failures when a variable has been involved last
+      unsigned long long int* lf;
+      /// Number of Q-scores
+      int n;
+      /// Number of failures
+      unsigned long long int nf;
+      /// Step size
+      double alpha;
+      /// Allocate for \a n0 Q-scores
+      Storage(int n0);
+      /// Delete object
+      ~Storage(void);
+      /// Allocate memory from heap
+      static void* operator new(size_t s);
+      /// Free memory allocated from heap
+      static void  operator delete(void* p);
+    };
+
+    /// Initial step size
+    GECODE_KERNEL_EXPORT static const double alpha_init;
+    /// Smallest step size
+    GECODE_KERNEL_EXPORT static const double alpha_min;
+    /// Step size decrement per failure
+    GECODE_KERNEL_EXPORT static const double alpha_dec;
+    /// Reward multiplier for changes leading to failure
+    GECODE_KERNEL_EXPORT static const double reward_fail;
+    /// Reward multiplier for changes not leading to failure
+    GECODE_KERNEL_EXPORT static const double reward_fix;
+
+    /// Pointer to storage object
+    Storage* storage;
+    /// Update Q-score at position \a i for change with reward multiplier \a m
+    void update(int i, double m);
+    /// Record failure in which the view at position \a i has been involved
+    void involved(int i);
+    /// Count failure
+    void fail(void);
+    /// Acquire mutex
+    void acquire(void);
+    /// Release mutex
+    void release(void);
+    /**
+     * \brief Initialize for \a n views
+     *
+     * This member function can only be used once and only if the
+     * CHB storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_KERNEL_EXPORT
+    void init(int n);
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized CHB storage is init and the assignment operator.
+     *
+     */
+    CHB(void);
+    /// Copy constructor
+    GECODE_KERNEL_EXPORT
+    CHB(const CHB& a);
+    /// Assignment operator
+    GECODE_KERNEL_EXPORT
+    CHB& operator =(const CHB& a);
+    /// Initialize for views \a x
+    template<class View>
+    CHB(Home home, ViewArray<View>& x);
+    /// Initialize for views \a x
+    template<class View>
+    void init(Home home, ViewArray<View>& x);
+    /// Test whether already initialized
+    bool initialized(void) const;
+    /// Default (empty) CHB information
+    GECODE_KERNEL_EXPORT static const CHB def;
+    //@}
+
+    /// \name Update and delete CHB information
+    //@{
+    /// Updating during cloning
+    GECODE_KERNEL_EXPORT
+    void update(Space& home, bool share, CHB& a);
+    /// Destructor
+    GECODE_KERNEL_EXPORT
+    ~CHB(void);
+    //@}
+    
+    /// \name Information access
+    //@{
+    /// Return Q-score at position \a i
+    double operator [](int i) const;
+    /// Return number of Q-scores
+    int size(void) const;
+    /// Return number of failures recorded so far
+    GECODE_KERNEL_EXPORT
+    unsigned long long int failures(void) const;
+    //@}
+  };
+
+  /// Propagator for recording CHB information
+  template<class View>
+  class CHB::Recorder : public NaryPropagator<View,PC_GEN_NONE> {
+  protected:
+    using NaryPropagator<View,PC_GEN_NONE>::x;
+    /// Advisor with index and change information
+    class Idx : public Advisor {
+    protected:
+      /// Index and mark information
+      int _info;
+    public:
+      /// Constructor for creation
+      Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+      /// Constructor for cloning \a a
+      Idx(Space& home, bool share, Idx& a);
+      /// Mark advisor as modified
+      void mark(void);
+      /// Mark advisor as unmodified
+      void unmark(void);
+      /// Whether advisor's view has been marked
+      bool marked(void) const;
+      /// Get index of view
+      int idx(void) const;
+    };
+    /// Access to CHB information
+    CHB chb;
+    /// The advisor council
+    Council<Idx> c;
+    /// Constructor for cloning \a p
+    Recorder(Space& home, bool share, Recorder<View>& p);
+  public:
+    /// Constructor for creation
+    Recorder(Home home, ViewArray<View>& x, CHB& chb);
+    /// Copy propagator during cloning
+    virtual Propagator* copy(Space& home, bool share);
+    /// Cost function (crazy so that propagator is likely to run last)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Record failure
+    virtual void failed(Space& home, const Propagator& p);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post CHB recorder propagator
+    static ExecStatus post(Home home, ViewArray<View>& x, CHB& chb);
+  };
+    
+  /**
+   * \brief Print CHB Q-scores enclosed in curly brackets
+   * \relates CHB
+   */
+  template<class Char, class Traits>
+  std::basic_ostream<Char,Traits>&
+  operator <<(std::basic_ostream<Char,Traits>& os,
+             const CHB& chb);
+
+
+  /*
+   * Advisor for CHB recorder
+   *
+   */
+  template<class View>
+  forceinline
+  CHB::Recorder<View>::Idx::Idx(Space& home, Propagator& p, 
+                                Council<Idx>& c, int i)
+    : Advisor(home,p,c), _info(i << 1) {}
+  template<class View>
+  forceinline
+  CHB::Recorder<View>::Idx::Idx(Space& home, bool share, Idx& a)
+    : Advisor(home,share,a), _info(a._info) {
+  }
+  template<class View>
+  forceinline void
+  CHB::Recorder<View>::Idx::mark(void) {
+    _info |= 1;
+  }
+  template<class View>
+  forceinline void
+  CHB::Recorder<View>::Idx::unmark(void) {
+    _info &= ~1;
+  }
+  template<class View>
+  forceinline bool
+  CHB::Recorder<View>::Idx::marked(void) const {
+    return (_info & 1) != 0;
+  }
+  template<class View>
+  forceinline int
+  CHB::Recorder<View>::Idx::idx(void) const {
+    return _info >> 1;
+  }
+
+
+
+  /*
+   * Posting of CHB recorder propagator
+   *
+   */
+  template<class View>
+  forceinline
+  CHB::Recorder<View>::Recorder(Home home, ViewArray<View>& x, 
+                                CHB& chb0)
+    : NaryPropagator<View,PC_GEN_NONE>(home,x), chb(chb0), c(home) {
+    home.notice(*this,AP_DISPOSE);
+    home.notice(*this,AP_FAILURE);
+    for (int i=x.size(); i--; )
+      if (!x[i].assigned())
+        x[i].subscribe(home,*new (home) Idx(home,*this,c,i));
+  }
+
+  template<class View>
+  forceinline ExecStatus
+  CHB::Recorder<View>::post(Home home, ViewArray<View>& x, CHB& chb) {
+    (void) new (home) Recorder<View>(home,x,chb);
+    return ES_OK;
+  }
+
+
+  /*
+   * CHB value storage
+   *
+   */
+  forceinline void*
+  CHB::Storage::operator new(size_t s) {
+    return Gecode::heap.ralloc(s);
+  }
+  forceinline void
+  CHB::Storage::operator delete(void* p) {
+    Gecode::heap.rfree(p);
+  }
+  forceinline
+  CHB::Storage::Storage(int n0)
+    : use_cnt(1), q(heap.alloc<double>(n0)),
+      lf(heap.alloc<unsigned long long int>(n0)), n(n0), nf(0ULL),
+      alpha(alpha_init) {
+    for (int i=n; i--; ) {
+      q[i] = 0.05; lf[i] = 0ULL;
+    }
+  }
+  forceinline
+  CHB::Storage::~Storage(void) {
+    heap.free<double>(q,n);
+    heap.free<unsigned long long int>(lf,n);
+  }
+
+
+  /*
+   * CHB
+   *
+   */
+
+  forceinline void
+  CHB::update(int i, double m) {
+    assert(storage != NULL);
+    assert((i >= 0) && (i < storage->n));
+    double r = m / static_cast<double>(storage->nf - storage->lf[i] + 1ULL);
+    storage->q[i] = (1.0 - storage->alpha) * storage->q[i] 
+      + storage->alpha * r;
+  }
+  forceinline void
+  CHB::involved(int i) {
+    assert(storage != NULL);
+    assert((i >= 0) && (i < storage->n));
+    storage->lf[i] = storage->nf;
+  }
+  forceinline void
+  CHB::fail(void) {
+    assert(storage != NULL);
+    storage->nf++;
+    if (storage->alpha > alpha_min)
+      storage->alpha -= alpha_dec;
+  }
+  forceinline double
+  CHB::operator [](int i) const {
+    assert(storage != NULL);
+    assert((i >= 0) && (i < storage->n));
+    return storage->q[i];
+  }
+  forceinline int
+  CHB::size(void) const {
+    return storage->n;
+  }
+  forceinline void
+  CHB::acquire(void) {
+    storage->m.acquire();
+  }
+  forceinline void
+  CHB::release(void) {
+    storage->m.release();
+  }
+
+
+  forceinline
+  CHB::CHB(void) : storage(NULL) {}
+
+  forceinline bool
+  CHB::initialized(void) const {
+    return storage != NULL;
+  }
+
+  template<class View>
+  forceinline
+  CHB::CHB(Home home, ViewArray<View>& x) {
+    init(x.size());
+    (void) Recorder<View>::post(home,x,*this);
+  }
+  template<class View>
+  forceinline void
+  CHB::init(Home home, ViewArray<View>& x) {
+    init(x.size());
+    (void) Recorder<View>::post(home,x,*this);
+  }
+
+  template<class Char, class Traits>
+  std::basic_ostream<Char,Traits>&
+  operator <<(std::basic_ostream<Char,Traits>& os,
+              const CHB& chb) {
+    std::basic_ostringstream<Char,Traits> s;
+    s.copyfmt(os); s.width(0);
+    s << '{';
+    if (chb.size() > 0) {
+      s << chb[0];
+      for (int i=1; i<chb.size(); i++)
+        s << ", " << chb[i];
+    }
+    s << '}';
+    return os << s.str();
+  }
+  
+
+  /*
+   * Propagation for CHB recorder
+   *
+   */
+  template<class View>
+  forceinline
+  CHB::Recorder<View>::Recorder(Space& home, bool share,
+                                Recorder<View>& p) 
+    : NaryPropagator<View,PC_GEN_NONE>(home,share,p) {
+    chb.update(home, share, p.chb);
+    c.update(home, share, p.c);
+  }
+
+  template<class View>
+  Propagator*
+  CHB::Recorder<View>::copy(Space& home, bool share) {
+    return new (home) Recorder<View>(home, share, *this);
+  }
+
+  template<class View>
+  inline size_t
+  CHB::Recorder<View>::dispose(Space& home) {
+    // Delete access to CHB information
+    home.ignore(*this,AP_DISPOSE);
+    home.ignore(*this,AP_FAILURE);
+    chb.~CHB();
+    // Cancel remaining advisors
+    for (Advisors<Idx> as(c); as(); ++as)
+      x[as.advisor().idx()].cancel(home,as.advisor());
+    c.dispose(home);
+    (void) NaryPropagator<View,PC_GEN_NONE>::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View>
+  PropCost 
+  CHB::Recorder<View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::crazy(PropCost::HI,1000);
+  }
+
+  template<class View>
+  ExecStatus
+  CHB::Recorder<View>::advise(Space&, Advisor& a, const Delta&) {
+    static_cast<Idx&>(a).mark();
+    return ES_NOFIX;
+  }
+
+  template<class View>
+  ExecStatus
+  CHB::Recorder<View>::propagate(Space& home, const ModEventDelta&) {
+    // Lock CHB information
+    chb.acquire();
+    for (Advisors<Idx> as(c); as(); ++as)
+      if (as.advisor().marked()) {
+        int i = as.advisor().idx();
+        as.advisor().unmark();
+        chb.update(i,reward_fix);
+        if (x[i].assigned())
+          as.advisor().dispose(home,c);
+      }
+    chb.release();
+    return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  template<class View>
+  void
+  CHB::Recorder<View>::failed(Space&, const Propagator&) {
+    // Lock CHB information
+    chb.acquire();
+    chb.fail();
+    for (Advisors<Idx> as(c); as(); ++as)
+      if (as.advisor().marked()) {
+        int i = as.advisor().idx();
+        as.advisor().unmark();
+        chb.involved(i);
+        chb.update(i,reward_fail);
+      }
+    chb.release();
+  }
+  
+}
+
+// STATISTICS: kernel-branch
@@ -78,6 +78,37 @@ namespace Gecode {
     return ES_FAILED;
   }
 
+  ExecStatus
+  Propagator::advise_batch(Space& home, Advisor* a[], int n, 
+                           const Delta& d) {
+    ExecStatus es = ES_FIX;
+    for (int i=0; i<n; i++)
+      switch (advise(home,*a[i],d)) {
+      case ES_FIX:
+        break;
+      case ES_FAILED:
+        return ES_FAILED;
+      case ES_NOFIX:
+        if (es == ES_FIX)
+          es = ES_NOFIX;
+        break;
+      case ES_NOFIX_FORCE:
+        es = ES_NOFIX_FORCE;
+        break;
+      default:
+        GECODE_NEVER;
+      }
+    return es;
+  }
+
+  void
+  Propagator::failed(Space&, const Propagator&) {}
+
+  void
+  Propagator::solndistrib(Space&, SolnDistribution&) const {}
+
+  SolnDistribution::~SolnDistribution(void) {}
+
 
 
   /*
@@ -95,7 +126,9 @@ namespace Gecode {
 #endif
 
   Space::Space(void)
-    : sm(new SharedMemory), mm(sm), n_wmp(0) {
+    : sm(new SharedMemory), mm(sm), tr(NULL), sig(NULL),
+      pa((pa_default > 1) ? new PropPartition(pa_default,true) : NULL),
+      n_wmp(0), adapt(false), n_enq(0) {
 #ifdef GECODE_HAS_VAR_DISPOSE
     for (int i=0; i<AllVarConf::idx_d; i++)
       _vars_d[i] = NULL;
@@ -106,6 +139,8 @@ namespace Gecode {
     b_status = b_commit = Brancher::cast(&bl);
     // Initialize array for forced deletion to be empty
     d_fst = d_cur = d_lst = NULL;
+    // Initialize array for failure notification to be empty
+    f_fst = f_cur = f_lst = NULL;
     // Initialize space as stable but not failed
     pc.p.active = &pc.p.queue[0]-1;
     // Initialize propagator queues
@@ -132,6 +167,29 @@ namespace Gecode {
     }
   }
 
+  void
+  Space::f_resize(void) {
+    if (f_fst == NULL) {
+      // Create new array
+      f_fst = alloc<Propagator*>(4);
+      f_cur = f_fst;
+      f_lst = f_fst+4;
+    } else {
+      // Resize existing array
+      unsigned int n = static_cast<unsigned int>(f_lst - f_fst);
+      assert(n != 0);
+      f_fst = realloc<Propagator*>(f_fst,n,2*n);
+      f_cur = f_fst+n;
+      f_lst = f_fst+2*n;
+    }
+  }
+
+  forceinline void
+  Space::f_notify(const Propagator& p) {
+    for (Propagator** f = f_fst; f < f_cur; f++)
+      (*f)->failed(*this,p);
+  }
+
   unsigned int
   Space::propagators(void) const {
     unsigned int n = 0;
@@ -158,8 +216,14 @@ namespace Gecode {
   }
 
   Space::~Space(void) {
+    // Make all memory writable
+    trail_release();
+    delete sig;
+    delete pa;
     // Mark space as failed
     fail();
+    // So that ignore knows that deletion is in progress
+    f_fst = f_cur = NULL;
     // Delete actors that must be deleted
     {
       Actor** a = d_fst;
@@ -198,11 +262,19 @@ namespace Gecode {
     if (failed()) {
       s = SS_FAILED; goto exit;
     }
+    // Propagate independent groups of propagators in parallel
+    if (pa != NULL) {
+      pa_propagate(stat);
+      if (failed()) {
+        s = SS_FAILED; goto exit;
+      }
+    }
     assert(pc.p.active <= &pc.p.queue[PropCost::AC_MAX+1]);
     // Check whether space is stable but not failed
     if (pc.p.active >= &pc.p.queue[0]) {
       Propagator* p;
       ModEventDelta med_o;
+      ExecStatus es;
       goto unstable;
     execute:
       stat.propagate++;
@@ -210,10 +282,23 @@ namespace Gecode {
       med_o = p->u.med;
       // Clear med but leave propagator in queue
       p->u.med = 0;
-      switch (p->propagate(*this,med_o)) {
+      if (!adapt) {
+        es = p->propagate(*this,med_o);
+      } else {
+        // Observe cost and whether any propagator gets scheduled
+        unsigned int n = n_enq;
+        unsigned long int t = Support::ticks();
+        es = p->propagate(*this,med_o);
+        p->pi.executed(Support::ticks() - t,
+                       (n != n_enq) || (es == ES_FAILED));
+      }
+      switch (es) {
       case ES_FAILED:
         // Count failure
         p->pi.fail(gpi);
+        // Notify propagators interested in failure
+        if (f_cur != f_fst)
+          f_notify(*p);
         // Mark as failed
         fail(); s = SS_FAILED; goto exit;
       case ES_NOFIX:
@@ -408,9 +493,11 @@ namespace Gecode {
   Space::Space(bool share, Space& s)
     : sm(s.sm->copy(share)), 
       mm(sm,s.mm,s.pc.p.n_sub*sizeof(Propagator**)),
-      gpi(s.gpi),
+      gpi(s.gpi), tr(NULL),
+      sig((s.sig != NULL) ? new SignatureTable(s.sig->removed) : NULL),
+      pa((s.pa != NULL) ? new PropPartition(s.pa->threads(),true) : NULL),
       d_fst(&Actor::sentinel),
-      n_wmp(s.n_wmp) {
+      n_wmp(s.n_wmp), adapt(s.adapt), n_enq(0) {
 #ifdef GECODE_HAS_VAR_DISPOSE
     for (int i=0; i<AllVarConf::idx_d; i++)
       _vars_d[i] = NULL;
@@ -422,10 +509,15 @@ namespace Gecode {
     pc.c.local = NULL;
     // Copy all propagators
     {
+      bool grouped = sm->options().group;
+      if (grouped)
+        group_copy(share,s);
       ActorLink* p = &pl;
       ActorLink* e = &s.pl;
       for (ActorLink* a = e->next(); a != e; a = a->next()) {
-        Actor* c = Actor::cast(a)->copy(*this,share);
+        // If already copied, the copy is available as forwarding pointer
+        Actor* c = grouped ? Actor::cast(a->prev()) :
+          Actor::cast(a)->copy(*this,share);
         // Link copied actor
         p->next(ActorLink::cast(c)); ActorLink::cast(c)->prev(p);
         // Note that forwarding is done in the constructors
@@ -461,6 +553,40 @@ namespace Gecode {
     }
   }
 
+  void
+  Space::group_copy(bool share, Space& s) {
+    // The propagators are kept in the order of their most recent execution
+    Region r(s);
+    unsigned int n = 0;
+    for (ActorLink* a = s.pl.next(); a != &s.pl; a = a->next())
+      n++;
+    Propagator** p = r.alloc<Propagator*>(n);
+    unsigned char* c = r.alloc<unsigned char>(n);
+    unsigned int g[PropCost::AC_MAX+2];
+    for (int i=0; i<PropCost::AC_MAX+2; i++)
+      g[i]=0;
+    {
+      unsigned int i = 0;
+      for (ActorLink* a = s.pl.next(); a != &s.pl; a = a->next(), i++) {
+        p[i] = Propagator::cast(a);
+        // Cheapest propagators go first
+        c[i] = static_cast<unsigned char>
+          (PropCost::AC_MAX - p[i]->cost(s,p[i]->u.med).ac);
+        g[c[i]+1]++;
+      }
+    }
+    // Compute where the groups start
+    for (int i=1; i<PropCost::AC_MAX+2; i++)
+      g[i] += g[i-1];
+    // Sort propagators stably by group
+    Propagator** q = r.alloc<Propagator*>(n);
+    for (unsigned int i=0; i<n; i++)
+      q[g[c[i]]++] = p[i];
+    // Copy propagators, linking is done by the caller
+    for (unsigned int i=0; i<n; i++)
+      (void) q[i]->copy(*this,share);
+  }
+
   Space*
   Space::_clone(bool share) {
     if (failed())
@@ -474,6 +600,23 @@ namespace Gecode {
     if (c->d_fst != &Actor::sentinel)
       throw SpaceNotCloned("Space::clone");
 
+    // Setup array for failure notification in c
+    {
+      unsigned int n = static_cast<unsigned int>(f_cur - f_fst);
+      if (n == 0) {
+        // No propagators
+        c->f_fst = c->f_cur = c->f_lst = NULL;
+      } else {
+        // Leave one entry free
+        c->f_fst = c->alloc<Propagator*>(n+1);
+        c->f_cur = c->f_fst;
+        c->f_lst = c->f_fst+n+1;
+        for (Propagator** f_fst_iter = f_fst; f_fst_iter != f_cur; 
+             f_fst_iter++)
+          *(c->f_cur++) = Propagator::cast((*f_fst_iter)->prev());
+      }
+    }
+
     // Setup array for actor disposal in c
     {
       unsigned int n = static_cast<unsigned int>(d_cur - d_fst);
@@ -554,6 +697,10 @@ namespace Gecode {
     throw SpaceConstrainUndefined();
   }
 
+  void
+  Space::asset(unsigned int) {
+  }
+
   void
   LocalObject::fwdcopy(Space& home, bool share) {
     ActorLink::cast(this)->prev(copy(home,share));
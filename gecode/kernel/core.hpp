@@ -218,6 +218,8 @@ namespace Gecode {
   class Propagator;
   class LocalObject;
   class Advisor;
+  class Signature;
+  class SignatureTable;
   template<class A> class Council;
   template<class A> class Advisors;
   template<class VIC> class VarImp;
@@ -370,6 +372,8 @@ namespace Gecode {
     void remove(Space& home, Propagator* p, PropCond pc);
     /// Remove advisor from subscription array
     void remove(Space& home, Advisor* a);
+    /// Group \a p with the first (or \a all) subscribed propagators
+    void partition(Space& home, const Actor* p, bool all);
 
 
   protected:
@@ -444,6 +448,14 @@ namespace Gecode {
      * is not available during cloning.
      */
     double afc(void) const;
+    /**
+     * \brief Test whether propagator \a p depends on the variable implementation
+     *
+     * The propagator \a p depends on the variable implementation if
+     * it is subscribed to it or if one of its advisors is subscribed
+     * to it. Note that this information is not available during cloning.
+     */
+    bool subscribed(const Propagator& p) const;
     //@}
 
     /// \name Cloning variables
@@ -586,6 +598,15 @@ namespace Gecode {
     static PropCost binary(PropCost::Mod m);
     /// Single variable for modifier \a pcm
     static PropCost unary(PropCost::Mod m);
+    /**
+     * \brief Cost for observed propagator information \a pi
+     *
+     * The cost is computed from the observed cost of an execution
+     * divided by the fraction of productive executions. Every cost
+     * value covers a range of observed costs four times as large
+     * as the range of the next cheaper cost value.
+     */
+    static PropCost observed(const PropInfo& pi);
   };
 
 
@@ -608,7 +629,15 @@ namespace Gecode {
      * is only monotonic on assignments.
      *
      */
-    AP_WEAKLY  = (1 << 1)
+    AP_WEAKLY  = (1 << 1),
+    /**
+     * \brief Propagator must be notified of failure
+     *
+     * If a propagator has this property, its member function
+     * Propagator::failed is called whenever propagation in its
+     * home space fails.
+     */
+    AP_FAILURE = (1 << 2)
   };
 
 
@@ -741,9 +770,33 @@ namespace Gecode {
     void fail(void);
     ///  Notice actor property
     void notice(Actor& a, ActorProperty p);
+    /// Test whether a propagator with signature \a s has been posted
+    bool identical(const Signature& s);
+    /// Record that a propagator with signature \a s is implied
+    void implied(const Signature& s);
     //@}
   };
 
+  /**
+   * \brief Solution distribution for counting-based search
+   *
+   * Propagators report estimated solution densities to an object of
+   * this class: the density of a variable-value pair is the
+   * estimated fraction of the solutions of the propagator's
+   * constraint in which the variable takes the value.
+   *
+   * \ingroup TaskActor
+   */
+  class GECODE_VTABLE_EXPORT SolnDistribution {
+  public:
+    /// Test whether densities for variable implementation \a x are needed
+    virtual bool supports(const VarImpBase* x) const = 0;
+    /// Report density \a d for variable implementation \a x and value \a v
+    virtual void marginal(const VarImpBase* x, int v, double d) = 0;
+    /// Destructor
+    GECODE_KERNEL_EXPORT virtual ~SolnDistribution(void);
+  };
+
   /**
    * \brief Base-class for propagators
    * \ingroup TaskActor
@@ -849,6 +902,51 @@ namespace Gecode {
      */
     GECODE_KERNEL_EXPORT
     virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /**
+     * \brief Advise function for several advisors
+     *
+     * The \a n advisors in \a a are advisors of this propagator that
+     * are subscribed to the same variable. Rather than calling the
+     * advise function for each advisor, the variable calls this function
+     * once for all of them, where the delta \a d describes the same
+     * modification for all advisors.
+     *
+     * The function must return ES_FAILED if any advisor has detected
+     * failure. Otherwise, it must return the strongest execution status
+     * the advise function would have returned for any advisor (where
+     * ES_NOFIX_FORCE is stronger than ES_NOFIX which is stronger than
+     * ES_FIX). Advisors can be disposed as for the advise function.
+     *
+     * The default implementation calls the advise function for each
+     * advisor. A propagator should specialize this function if it
+     * can handle several advisors more efficiently.
+     */
+    GECODE_KERNEL_EXPORT
+    virtual ExecStatus advise_batch(Space& home, Advisor* a[], int n,
+                                    const Delta& d);
+    /**
+     * \brief Notification of failure
+     *
+     * The function is called when propagation in \a home has failed,
+     * where \a p is the propagator that has detected the failure.
+     * The function is only called if the propagator has noticed the
+     * actor property AP_FAILURE. It must neither modify
+     * variables nor post or dispose actors.
+     *
+     */
+    GECODE_KERNEL_EXPORT
+    virtual void failed(Space& home, const Propagator& p);
+    /**
+     * \brief Report solution distribution to \a sd
+     *
+     * The function reports the estimated solution densities of the
+     * variable-value pairs of the propagator's constraint as used by
+     * counting-based search. It must neither modify variables nor
+     * post or dispose actors. The default does not report anything.
+     *
+     */
+    GECODE_KERNEL_EXPORT
+    virtual void solndistrib(Space& home, SolnDistribution& sd) const;
     //@}
     /// \name Information
     //@{
@@ -921,6 +1019,9 @@ namespace Gecode {
     template<class VIC> friend class VarImp;
     template<class A> friend class Council;
     template<class A> friend class Advisors;
+  public:
+    /// Maximal number of advisors passed to Propagator::advise_batch
+    static const int n_batch = 8;
   private:
     /// Is the advisor disposed?
     bool disposed(void) const;
@@ -1150,6 +1251,10 @@ namespace Gecode {
    */
   class CloneStatistics {
   public:
+    /// Number of heap chunks allocated from the heap
+    unsigned long int hc_alloc;
+    /// Number of heap chunks recycled from the cache of heap chunks
+    unsigned long int hc_reuse;
     /// Initialize
     CloneStatistics(void);
     /// Reset information
@@ -1189,6 +1294,7 @@ namespace Gecode {
     friend class SharedHandle;
     friend class LocalObject;
     friend class Region;
+    friend class Trail;
   private:
     /// Manager for shared memory areas
     SharedMemory* sm;
@@ -1196,6 +1302,12 @@ namespace Gecode {
     MemoryManager mm;
     /// Global propagator information
     GlobalPropInfo gpi;
+    /// Trail for undoing changes (NULL if space has not been marked)
+    Trail* tr;
+    /// Signatures of posted propagators (NULL if not detected)
+    SignatureTable* sig;
+    /// Partition of propagators (NULL if propagation is sequential)
+    PropPartition* pa;
     /// Doubly linked list of all propagators
     ActorLink pl;
     /// Doubly linked list of all branchers
@@ -1282,6 +1394,19 @@ namespace Gecode {
     /// Resize disposal array
     GECODE_KERNEL_EXPORT void d_resize(void);
 
+    /// First propagator to be notified of failure
+    Propagator** f_fst;
+    /// Current propagator to be notified of failure
+    Propagator** f_cur;
+    /// Last propagator to be notified of failure
+    Propagator** f_lst;
+    /// Resize failure notification array
+    GECODE_KERNEL_EXPORT void f_resize(void);
+    /// Notify propagators that propagator \a p has failed
+    void f_notify(const Propagator& p);
+    /// Copy propagators of \a s grouped by cost during cloning
+    void group_copy(bool share, Space& s);
+
     /**
      * \brief Number of weakly monotonic propagators
      *
@@ -1291,6 +1416,20 @@ namespace Gecode {
      */
     unsigned int n_wmp;
 
+    /// Whether propagators are scheduled by their observed cost
+    bool adapt;
+    /// Number of times a propagator has been enqueued
+    unsigned int n_enq;
+
+    /// Space for propagating some propagators of a space
+    class Shadow;
+    /// Initialize as shadow space of \a home
+    Space(Space& home, Shadow* s);
+    /// Default number of threads for parallel propagation
+    GECODE_KERNEL_EXPORT static unsigned int pa_default;
+    /// Propagate independent groups of propagators in parallel
+    GECODE_KERNEL_EXPORT void pa_propagate(StatusStatistics& stat);
+
     /// Used for default argument
     GECODE_KERNEL_EXPORT static StatusStatistics unused_status;
     /// Used for default argument
@@ -1398,6 +1537,19 @@ namespace Gecode {
      * \ingroup TaskModelScript
      */
     GECODE_KERNEL_EXPORT virtual void constrain(const Space& best);
+    /**
+     * \brief Configure space for asset \a i of portfolio search
+     *
+     * Portfolio search (see Portfolio) creates a copy of the root
+     * space for each of its assets and calls this function with the
+     * number \a i of the asset. Branchings posted here are used
+     * after all branchings posted before, so a space that is used
+     * with portfolio search typically posts its branching here. The
+     * default function does nothing.
+     *
+     * \ingroup TaskModelScript
+     */
+    GECODE_KERNEL_EXPORT virtual void asset(unsigned int i);
     /**
      * \brief Allocate memory from heap for new space
      * \ingroup TaskModelScript
@@ -1872,6 +2024,16 @@ namespace Gecode {
      * as well as additional memory allocated by actors.
      */
     size_t allocated(void) const;
+    /**
+     * \brief Set runtime parameters for memory management to \a mo
+     *
+     * The parameters are used by this space and all spaces that share
+     * memory with it, and are inherited by all clones created later.
+     * Statistics are recorded if requested by \a mo.
+     */
+    void memory(const MemoryOptions& mo);
+    /// Return runtime parameters for memory management
+    const MemoryOptions& memory(void) const;
     /**
      * \brief Flush cached memory blocks and AFC information
      *
@@ -1883,6 +2045,125 @@ namespace Gecode {
      */
     GECODE_KERNEL_EXPORT void flush(void);
     //@}
+    /**
+     * \defgroup FuncMemTrail Trailing for spaces
+     * \ingroup FuncMemSpace
+     *
+     * A space can be marked and later be reset to the state it had
+     * when it was marked. This is an alternative to cloning for
+     * backtracking, where only the memory that is modified after the
+     * mark is saved (see Gecode::Trail for details).
+     */
+    //@{
+    /**
+     * \brief Mark the current state of the space and return level of mark
+     *
+     * The space must not be failed. Only the memory of the space
+     * itself is trailed: data members of a subclass of Space must
+     * not be modified after the space has been marked.
+     */
+    GECODE_KERNEL_EXPORT unsigned int trail_mark(void);
+    /**
+     * \brief Undo all changes since the mark with level \a l
+     *
+     * After undoing, the space has the state it had when it has been
+     * marked with level \a l. The mark with level \a l is kept while
+     * all later marks are removed.
+     *
+     * Returns false and leaves the space unchanged if the changes can
+     * not be undone.
+     */
+    GECODE_KERNEL_EXPORT bool trail_undo(unsigned int l);
+    /// Remove all marks
+    GECODE_KERNEL_EXPORT void trail_release(void);
+    //@}
+    /**
+     * \name Identical propagators
+     *
+     * A space can detect whether a propagator is identical to a
+     * propagator that has already been posted, so that post functions
+     * can omit posting it. Detection is based on signatures that are
+     * computed by post functions (see Gecode::Signature).
+     *
+     * Only propagators posted to the same space are detected: a clone
+     * of a space detects identical propagators if the space does, but
+     * it does not know about the propagators posted to the space.
+     */
+    //@{
+    /// Enable (if \a b is true) or disable detection of identical propagators
+    GECODE_KERNEL_EXPORT void identical(bool b);
+    /// Test whether identical propagators are detected
+    bool identical(void) const;
+    /**
+     * \brief Test whether a propagator with signature \a s has been posted
+     *
+     * Returns true if a propagator with signature \a s has been posted
+     * before or is implied by posted propagators (see implied). Then,
+     * the propagator is counted as removed. Otherwise, the signature is
+     * recorded and false is returned.
+     *
+     * Always returns false if identical propagators are not detected.
+     */
+    GECODE_KERNEL_EXPORT bool identical(const Signature& s);
+    /**
+     * \brief Record that a propagator with signature \a s is implied
+     *
+     * A post function that posts a propagator that dominates the
+     * propagator with signature \a s records \a s, so that
+     * posting the dominated propagator later can be omitted.
+     */
+    GECODE_KERNEL_EXPORT void implied(const Signature& s);
+    /// Return number of propagators that have not been posted as they are identical
+    unsigned long int identical_removed(void) const;
+    //@}
+    /**
+     * \name Adaptive propagator scheduling
+     *
+     * By default, a propagator is scheduled according to the cost
+     * computed by its cost function. With adaptive scheduling, a
+     * propagator is scheduled according to its observed cost instead:
+     * the time its executions take, relative to how often an execution
+     * modifies a variable or fails. Propagators that have not been
+     * executed yet are scheduled according to their cost function.
+     *
+     * The observed cost is shared by a propagator and all its copies
+     * in clones. Scheduling only changes the order in which propagators
+     * are executed, not the fixpoint computed by status().
+     */
+    //@{
+    /// Schedule propagators by observed cost (if \a b is true) or by cost function
+    void adaptive(bool b);
+    /// Test whether propagators are scheduled by observed cost
+    bool adaptive(void) const;
+    //@}
+    /**
+     * \name Parallel propagation
+     *
+     * Propagators are partitioned into groups such that propagators
+     * from different groups never share a variable. When sufficiently
+     * many propagators are scheduled, status() propagates different
+     * groups in different threads before it propagates the remaining
+     * propagators sequentially. As all propagators eventually run in
+     * the same space, the computed fixpoint is the same as for
+     * sequential propagation.
+     *
+     * Groups are computed when propagators subscribe to variables.
+     * Hence, parallel propagation must be enabled before any propagator
+     * is posted; otherwise, only clones of the space propagate in
+     * parallel. Propagation is sequential while the space is trailed or
+     * while it contains weakly monotonic propagators or propagators
+     * that are notified about failure. Propagators must subscribe to
+     * all variables they modify, and propagators that post propagators
+     * during propagation must post them with home(*this).
+     */
+    //@{
+    /// Propagate with up to \a n threads (sequential if \a n is less than two)
+    GECODE_KERNEL_EXPORT void parallel(unsigned int n);
+    /// Return number of threads for propagation
+    unsigned int parallel(void) const;
+    /// Set number of threads for propagation of spaces created from now on
+    GECODE_KERNEL_EXPORT static void parallel_default(unsigned int n);
+    //@}
     /// Construction routines
     //@{
     /**
@@ -2046,9 +2327,20 @@ namespace Gecode {
     mm.template fl_dispose<s>(f,l);
   }
 
+  forceinline void
+  Space::memory(const MemoryOptions& mo) {
+    sm->options(mo);
+  }
+  forceinline const MemoryOptions&
+  Space::memory(void) const {
+    return sm->options();
+  }
+
   forceinline size_t
   Space::allocated(void) const {
     size_t s = mm.allocated();
+    if (tr != NULL)
+      s += tr->size();
     for (Actor** a = d_fst; a < d_cur; a++)
       s += (*a)->allocated();
     return s;
@@ -2438,6 +2730,9 @@ namespace Gecode {
       if (d_cur == d_lst)
         d_resize();
       *(d_cur++) = &a;
+      // The actor might acquire resources that are not trailed
+      if (tr != NULL)
+        tr->irreversible();
     }
     if (p & AP_WEAKLY) {
       if (n_wmp == 0)
@@ -2445,6 +2740,11 @@ namespace Gecode {
       else
         n_wmp++;
     }
+    if (p & AP_FAILURE) {
+      if (f_cur == f_lst)
+        f_resize();
+      *(f_cur++) = &static_cast<Propagator&>(a);
+    }
   }
 
   forceinline void
@@ -2462,20 +2762,39 @@ namespace Gecode {
         while (&a != *f)
           f++;
         *f = *(--d_cur);
+        // The actor might have released resources that are not trailed
+        if (tr != NULL)
+          tr->irreversible();
       }
     }
     if (p & AP_WEAKLY) {
       assert(n_wmp > 1);
       n_wmp--;
     }
+    if (p & AP_FAILURE) {
+      // Check wether array has already been discarded as space
+      // deletion is already in progress
+      Propagator** f = f_fst;
+      if (f != NULL) {
+        while (static_cast<Actor*>(*f) != &a)
+          f++;
+        *f = *(--f_cur);
+      }
+    }
   }
 
   forceinline Space*
-  Space::clone(bool share, CloneStatistics&) const {
+  Space::clone(bool share, CloneStatistics& stat) const {
+    // The clone only uses the cache of heap chunks if memory is shared
+    unsigned long int a = share ? sm->hc_alloc() : 0UL;
+    unsigned long int r = share ? sm->hc_reuse() : 0UL;
     // Clone is only const for search engines. During cloning, several data
     // structures are updated (e.g. forwarding pointers), so we have to
     // cast away the constness.
-    return const_cast<Space*>(this)->_clone(share);
+    Space* c = const_cast<Space*>(this)->_clone(share);
+    stat.hc_alloc += c->sm->hc_alloc() - a;
+    stat.hc_reuse += c->sm->hc_reuse() - r;
+    return c;
   }
 
   forceinline void
@@ -2913,8 +3232,11 @@ namespace Gecode {
    */
   forceinline void
   Space::enqueue(Propagator* p) {
+    n_enq++;
     ActorLink::cast(p)->unlink();
-    ActorLink* c = &pc.p.queue[p->cost(*this,p->u.med).ac];
+    ActorLink* c = &pc.p.queue[(adapt && (p->pi.cost() >= 0.0)) ?
+                               PropCost::observed(p->pi).ac :
+                               p->cost(*this,p->u.med).ac];
     c->tail(ActorLink::cast(p));
     if (c > pc.p.active)
       pc.p.active = c;
@@ -2938,6 +3260,20 @@ namespace Gecode {
   Space::failed(void) const {
     return pc.p.active > &pc.p.queue[PropCost::AC_MAX+1];
   }
+
+  forceinline void
+  Space::adaptive(bool b) {
+    adapt = b;
+  }
+  forceinline bool
+  Space::adaptive(void) const {
+    return adapt;
+  }
+
+  forceinline unsigned int
+  Space::parallel(void) const {
+    return (pa == NULL) ? 1U : pa->threads();
+  }
   forceinline bool
   Home::failed(void) const {
     return s.failed();
@@ -3008,6 +3344,28 @@ namespace Gecode {
     return entries;
   }
 
+  template<class VIC>
+  forceinline bool
+  VarImp<VIC>::subscribed(const Propagator& p) const {
+    // Check subscribed propagators
+    {
+      ActorLink** a = const_cast<VarImp<VIC>*>(this)->actor(0);
+      ActorLink** e = const_cast<VarImp<VIC>*>(this)->actorNonZero(pc_max+1);
+      while (a < e)
+        if (Propagator::cast(*(a++)) == &p)
+          return true;
+    }
+    // Check propagators of subscribed advisors
+    {
+      ActorLink** a = const_cast<VarImp<VIC>*>(this)->actorNonZero(pc_max+1);
+      ActorLink** e = const_cast<VarImp<VIC>*>(this)->b.base+entries;
+      while (a < e)
+        if (&Advisor::cast(*(a++))->propagator() == &p)
+          return true;
+    }
+    return false;
+  }
+
   template<class VIC>
   forceinline double
   VarImp<VIC>::afc(void) const {
@@ -3175,6 +3533,8 @@ namespace Gecode {
     GECODE_NEVER;
     found: ;
 #endif
+    if (home.pa != NULL)
+      partition(home,p,false);
   }
 
   template<class VIC>
@@ -3189,6 +3549,32 @@ namespace Gecode {
     // Enter subscription
     b.base[entries++] = *actorNonZero(pc_max+1);
     *actorNonZero(pc_max+1) = a;
+
+    if (home.pa != NULL)
+      partition(home,&a->propagator(),false);
+  }
+
+  template<class VIC>
+  void
+  VarImp<VIC>::partition(Space& home, const Actor* p, bool all) {
+    ActorLink** a = b.base;
+    ActorLink** e = b.base+entries;
+    ActorLink** f = actorNonZero(pc_max+1);
+    for ( ; a < e; a++) {
+      const Actor* q;
+      if (a < f) {
+        q = Propagator::cast(*a);
+      } else if ((*a == NULL) || Advisor::cast(*a)->disposed()) {
+        continue;
+      } else {
+        q = &Advisor::cast(*a)->propagator();
+      }
+      if (p == NULL)
+        p = q;
+      home.pa->unite(p,q);
+      if (!all)
+        return;
+    }
   }
 
   template<class VIC>
@@ -3343,7 +3729,23 @@ namespace Gecode {
       Advisor* a = Advisor::cast(*la);
       assert(!a->disposed());
       Propagator& p = a->propagator();
-      switch (p.advise(home,*a,d)) {
+      // Consecutive advisors of the same propagator are advised at once
+      int n = 1;
+      while ((n < Advisor::n_batch) && (la+n < le) &&
+             (la[n]->prev() == (*la)->prev()))
+        n++;
+      ExecStatus es;
+      if (n == 1) {
+        es = p.advise(home,*a,d);
+      } else {
+        // Advisors might be removed during execution, so take a copy
+        Advisor* b[Advisor::n_batch];
+        for (int i=n; i--; )
+          b[i] = Advisor::cast(la[i]);
+        es = p.advise_batch(home,b,n,d);
+        la += n-1;
+      }
+      switch (es) {
       case ES_FIX:
         break;
       case ES_FAILED:
@@ -3400,7 +3802,11 @@ namespace Gecode {
   VarImp<VIC>::update(Space& home, ActorLink**& sub) {
     VarImp<VIC>* x = static_cast<VarImp<VIC>*>(home.pc.c.vars_u[idx_c]);
     while (x != NULL) {
-      VarImp<VIC>* n = x->next(); x->forward()->update(x,sub); x = n;
+      VarImp<VIC>* n = x->next();
+      VarImp<VIC>* y = x->forward(); y->update(x,sub);
+      if (home.pa != NULL)
+        y->partition(home,NULL,true);
+      x = n;
     }
   }
 
@@ -3452,19 +3858,23 @@ namespace Gecode {
   }
 
   forceinline void
-  CloneStatistics::reset(void) {}
+  CloneStatistics::reset(void) {
+    hc_alloc = 0;
+    hc_reuse = 0;
+  }
 
   forceinline
-  CloneStatistics::CloneStatistics(void) {
-    reset();
-  }
+  CloneStatistics::CloneStatistics(void)
+    : hc_alloc(0), hc_reuse(0) {}
   forceinline CloneStatistics
-  CloneStatistics::operator +(const CloneStatistics&) {
-    CloneStatistics s;
-    return s;
+  CloneStatistics::operator +(const CloneStatistics& s) {
+    CloneStatistics t(s);
+    return t += *this;
   }
   forceinline CloneStatistics&
-  CloneStatistics::operator +=(const CloneStatistics&) { 
+  CloneStatistics::operator +=(const CloneStatistics& s) { 
+    hc_alloc += s.hc_alloc;
+    hc_reuse += s.hc_reuse;
     return *this;
   }
 
@@ -3555,6 +3965,15 @@ namespace Gecode {
   PropCost::unary(PropCost::Mod m) {
     return (m == LO) ? AC_UNARY_LO : AC_UNARY_HI;
   }
+  forceinline PropCost
+  PropCost::observed(const PropInfo& pi) {
+    // Observed cost per productive execution
+    double c = pi.cost() / (pi.yield() + 1.0/16.0);
+    int ac = AC_MAX;
+    for (double b = 256.0; (ac > 0) && (c >= b); b *= 4.0)
+      ac--;
+    return static_cast<ActualCost>(ac);
+  }
 
   /*
    * Iterators for propagators and branchers of a space
@@ -107,6 +107,62 @@ namespace Gecode {
     ActivityWrongArity(const char* l);
   };
 
+  /// %Exception: missing CHB information
+  class GECODE_VTABLE_EXPORT MissingCHB : public Exception {
+  public:
+    /// Initialize with location \a l
+    MissingCHB(const char* l);
+  };
+
+  /// %Exception: CHB information has wrong arity
+  class GECODE_VTABLE_EXPORT CHBWrongArity : public Exception {
+  public:
+    /// Initialize with location \a l
+    CHBWrongArity(const char* l);
+  };
+
+  /// %Exception: missing weighted degree information
+  class GECODE_VTABLE_EXPORT MissingWDeg : public Exception {
+  public:
+    /// Initialize with location \a l
+    MissingWDeg(const char* l);
+  };
+
+  /// %Exception: weighted degree information has wrong arity
+  class GECODE_VTABLE_EXPORT WDegWrongArity : public Exception {
+  public:
+    /// Initialize with location \a l
+    WDegWrongArity(const char* l);
+  };
+
+  /// %Exception: missing impact information
+  class GECODE_VTABLE_EXPORT MissingImpact : public Exception {
+  public:
+    /// Initialize with location \a l
+    MissingImpact(const char* l);
+  };
+
+  /// %Exception: impact information has wrong arity
+  class GECODE_VTABLE_EXPORT ImpactWrongArity : public Exception {
+  public:
+    /// Initialize with location \a l
+    ImpactWrongArity(const char* l);
+  };
+
+  /// %Exception: missing phase information
+  class GECODE_VTABLE_EXPORT MissingPhase : public Exception {
+  public:
+    /// Initialize with location \a l
+    MissingPhase(const char* l);
+  };
+
+  /// %Exception: phase information has wrong arity
+  class GECODE_VTABLE_EXPORT PhaseWrongArity : public Exception {
+  public:
+    /// Initialize with location \a l
+    PhaseWrongArity(const char* l);
+  };
+
   //@}
 
   /*
@@ -152,6 +208,38 @@ namespace Gecode {
   ActivityWrongArity::ActivityWrongArity(const char* l)
     : Exception(l,"Activity has wrong number of variables") {}
 
+  inline
+  MissingCHB::MissingCHB(const char* l)
+    : Exception(l,"Missing CHB information for branching") {}
+
+  inline
+  CHBWrongArity::CHBWrongArity(const char* l)
+    : Exception(l,"CHB information has wrong number of variables") {}
+
+  inline
+  MissingWDeg::MissingWDeg(const char* l)
+    : Exception(l,"Missing weighted degree information for branching") {}
+
+  inline
+  WDegWrongArity::WDegWrongArity(const char* l)
+    : Exception(l,"Weighted degree information has wrong number of variables") {}
+
+  inline
+  MissingImpact::MissingImpact(const char* l)
+    : Exception(l,"Impact information is missing") {}
+
+  inline
+  ImpactWrongArity::ImpactWrongArity(const char* l)
+    : Exception(l,"Impact information has wrong number of variables") {}
+
+  inline
+  MissingPhase::MissingPhase(const char* l)
+    : Exception(l,"Phase information is missing") {}
+
+  inline
+  PhaseWrongArity::PhaseWrongArity(const char* l)
+    : Exception(l,"Phase information has wrong number of variables") {}
+
 }
 
 // STATISTICS: kernel-other
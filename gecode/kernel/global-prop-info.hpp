@@ -44,6 +44,10 @@ namespace Gecode {
   private:
     /// Accumulated failure count
     double _afc;
+    /// Observed cost of an execution in ticks (negative if never executed)
+    double _cost;
+    /// Observed fraction of executions that modified variables or failed
+    double _yield;
   public:
     /// Initialize
     PropInfo(void);
@@ -53,6 +57,12 @@ namespace Gecode {
     double afc(void) const;
     /// Increment failure count
     void fail(GlobalPropInfo& gpi);
+    /// Return observed cost of an execution (negative if never executed)
+    double cost(void) const;
+    /// Return observed fraction of productive executions
+    double yield(void) const;
+    /// Record execution taking \a t ticks that was productive if \a p is true
+    void executed(unsigned long int t, bool p);
   };
 
   /// Globally shared object for propagator information
@@ -123,15 +133,36 @@ namespace Gecode {
    */
   forceinline
   PropInfo::PropInfo(void)
-    : _afc(0.0) {}
+    : _afc(0.0), _cost(-1.0), _yield(1.0) {}
   forceinline void
   PropInfo::init(void) {
-    _afc=0.0;
+    _afc=0.0; _cost=-1.0; _yield=1.0;
   }
   forceinline double
   PropInfo::afc(void) const {
     return _afc;
   }
+  forceinline double
+  PropInfo::cost(void) const {
+    return _cost;
+  }
+  forceinline double
+  PropInfo::yield(void) const {
+    return _yield;
+  }
+  forceinline void
+  PropInfo::executed(unsigned long int t, bool p) {
+    /*
+     * The information is shared by all copies of a propagator, possibly
+     * in different threads. As it is only used for scheduling, it is
+     * updated without synchronization.
+     */
+    if (_cost < 0.0)
+      _cost = static_cast<double>(t);
+    else
+      _cost += (static_cast<double>(t) - _cost) / 8.0;
+    _yield += ((p ? 1.0 : 0.0) - _yield) / 8.0;
+  }
 
 
   /*
@@ -0,0 +1,335 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <iostream>
+#include <sstream>
+
+namespace Gecode {
+
+  /**
+   * \brief The shared handle for immutable objects
+   *
+   * An immutable object can not be modified after it has been created.
+   * Hence, unlike for a SharedHandle, updating a handle during cloning
+   * never copies the object, even if cloning does not share data (that
+   * is, for spaces used by different threads). The reference count is
+   * maintained under a mutex, so that spaces in different threads can
+   * safely share the object.
+   *
+   * \ingroup FuncSupportShared
+   */
+  class ImmutableHandle {
+  public:
+    /**
+     * \brief The immutable object
+     *
+     * Immutable objects must inherit from this base class.
+     *
+     * \ingroup FuncSupportShared
+     */
+    class Object {
+      friend class ImmutableHandle;
+    private:
+      /// Mutex for the reference count
+      Support::Mutex m;
+      /// The counter used for reference counting
+      unsigned int use_cnt;
+    public:
+      /// Initialize
+      Object(void);
+      /// Delete immutable object
+      virtual ~Object(void);
+      /// Allocate memory from heap
+      static void* operator new(size_t s);
+      /// Free memory allocated from heap
+      static void  operator delete(void* p);
+    };
+  private:
+    /// The immutable object
+    Object* o;
+    /// Subscribe handle to object
+    void subscribe(void);
+    /// Cancel subscription of handle to object
+    void cancel(void);
+  public:
+    /// Create handle with no object pointing to
+    ImmutableHandle(void);
+    /// Create handle that points to immutable object \a io
+    ImmutableHandle(ImmutableHandle::Object* io);
+    /// Copy constructor maintaining reference count
+    ImmutableHandle(const ImmutableHandle& ih);
+    /// Assignment operator maintaining reference count
+    ImmutableHandle& operator =(const ImmutableHandle& ih);
+    /// Updating during cloning (always shares the object)
+    void update(Space& home, bool share, ImmutableHandle& ih);
+    /// Destructor that maintains reference count
+    ~ImmutableHandle(void);
+  protected:
+    /// Access to the immutable object
+    ImmutableHandle::Object* object(void) const;
+  };
+
+  /**
+   * \brief Immutable array with arbitrary number of elements
+   *
+   * The elements of an immutable array are initialized when the array
+   * is created and can not be changed afterwards. They are shared by
+   * reference among all spaces (including spaces used by different
+   * threads), which makes immutable arrays the preferred choice for
+   * data of propagators that never changes after posting.
+   *
+   * \ingroup FuncSupportShared
+   */
+  template<class T>
+  class ImmutableArray : public ImmutableHandle {
+  protected:
+    /// Implementation of object for immutable arrays
+    class IAO : public ImmutableHandle::Object {
+    public:
+      /// Elements
+      T*  a;
+      /// Number of elements
+      int n;
+      /// Allocate for \a n elements
+      IAO(int n);
+      /// Delete object
+      virtual ~IAO(void);
+    };
+  public:
+    /// \name Associated types
+    //@{
+    /// Type of the view stored in this array
+    typedef T value_type;
+    /// Type of a constant reference to the value type
+    typedef const T& const_reference;
+    /// Type of a read-only pointer to the value type
+    typedef const T* const_pointer;
+    /// Type of the iterator used to iterate read-only through this array's elements
+    typedef const T* const_iterator;
+    //@}
+
+    /// Construct as not yet intialized
+    ImmutableArray(void);
+    /// Initialize from immutable array \a a (share elements)
+    ImmutableArray(const ImmutableArray& a);
+    /// Initialize from shared array \a a (copy elements)
+    explicit ImmutableArray(const SharedArray<T>& a);
+    /// Initialize from argument array \a a (copy elements)
+    explicit ImmutableArray(const ArgArrayBase<T>& a);
+
+    /// Access element at position \a i
+    const T& operator [](int i) const;
+
+    /// Return number of elements
+    int size(void) const;
+
+    /// \name Array iteration
+    //@{
+    /// Return a read-only iterator at the beginning of the array
+    const_iterator begin(void) const;
+    /// Return a read-only iterator past the end of the array
+    const_iterator end(void) const;
+    //@}
+  };
+
+  /**
+   * \brief Print array elements enclosed in curly brackets
+   * \relates ImmutableArray
+   */
+  template<class Char, class Traits, class T>
+  std::basic_ostream<Char,Traits>&
+  operator <<(std::basic_ostream<Char,Traits>& os,
+             const ImmutableArray<T>& x);
+
+
+  /*
+   * Immutable handles
+   *
+   */
+  forceinline
+  ImmutableHandle::Object::Object(void) : use_cnt(0) {}
+  forceinline
+  ImmutableHandle::Object::~Object(void) {
+    assert(use_cnt == 0);
+  }
+  forceinline void*
+  ImmutableHandle::Object::operator new(size_t s) {
+    return heap.ralloc(s);
+  }
+  forceinline void
+  ImmutableHandle::Object::operator delete(void* p) {
+    heap.rfree(p);
+  }
+
+  forceinline void
+  ImmutableHandle::subscribe(void) {
+    if (o != NULL) {
+      o->m.acquire(); o->use_cnt++; o->m.release();
+    }
+  }
+  forceinline void
+  ImmutableHandle::cancel(void) {
+    if (o != NULL) {
+      o->m.acquire();
+      bool d = (--o->use_cnt == 0);
+      o->m.release();
+      if (d)
+        delete o;
+    }
+    o=NULL;
+  }
+  forceinline
+  ImmutableHandle::ImmutableHandle(void) : o(NULL) {}
+  forceinline
+  ImmutableHandle::ImmutableHandle(ImmutableHandle::Object* io) : o(io) {
+    subscribe();
+  }
+  forceinline
+  ImmutableHandle::ImmutableHandle(const ImmutableHandle& ih) : o(ih.o) {
+    subscribe();
+  }
+  forceinline ImmutableHandle&
+  ImmutableHandle::operator =(const ImmutableHandle& ih) {
+    if (&ih != this) {
+      cancel(); o=ih.o; subscribe();
+    }
+    return *this;
+  }
+  forceinline void
+  ImmutableHandle::update(Space&, bool, ImmutableHandle& ih) {
+    o=ih.o; subscribe();
+  }
+  forceinline
+  ImmutableHandle::~ImmutableHandle(void) {
+    cancel();
+  }
+  forceinline ImmutableHandle::Object*
+  ImmutableHandle::object(void) const {
+    return o;
+  }
+
+
+  /*
+   * Immutable arrays
+   *
+   */
+  template<class T>
+  forceinline
+  ImmutableArray<T>::IAO::IAO(int n0) : n(n0) {
+    a = (n>0) ? heap.alloc<T>(n) : NULL;
+  }
+
+  template<class T>
+  ImmutableArray<T>::IAO::~IAO(void) {
+    if (n>0) {
+      heap.free<T>(a,n);
+    }
+  }
+
+  template<class T>
+  forceinline
+  ImmutableArray<T>::ImmutableArray(void) {}
+
+  template<class T>
+  forceinline
+  ImmutableArray<T>::ImmutableArray(const ImmutableArray<T>& ia)
+    : ImmutableHandle(ia) {}
+
+  template<class T>
+  ImmutableArray<T>::ImmutableArray(const SharedArray<T>& sa)
+    : ImmutableHandle(new IAO(sa.size())) {
+    IAO* io = static_cast<IAO*>(object());
+    for (int i=sa.size(); i--; )
+      io->a[i]=sa[i];
+  }
+
+  template<class T>
+  ImmutableArray<T>::ImmutableArray(const ArgArrayBase<T>& aa)
+    : ImmutableHandle(new IAO(aa.size())) {
+    IAO* io = static_cast<IAO*>(object());
+    for (int i=aa.size(); i--; )
+      io->a[i]=aa[i];
+  }
+
+  template<class T>
+  forceinline const T&
+  ImmutableArray<T>::operator [](int i) const {
+    assert(object() != NULL);
+    assert((i>=0) && (i<static_cast<IAO*>(object())->n));
+    return static_cast<IAO*>(object())->a[i];
+  }
+
+  template<class T>
+  forceinline int
+  ImmutableArray<T>::size(void) const {
+    assert(object() != NULL);
+    return static_cast<IAO*>(object())->n;
+  }
+
+  template<class T>
+  forceinline typename ImmutableArray<T>::const_iterator
+  ImmutableArray<T>::begin(void) const {
+    assert(object() != NULL);
+    return static_cast<IAO*>(object())->a;
+  }
+
+  template<class T>
+  forceinline typename ImmutableArray<T>::const_iterator
+  ImmutableArray<T>::end(void) const {
+    assert(object() != NULL);
+    return static_cast<IAO*>(object())->a + size();
+  }
+
+  template<class Char, class Traits, class T>
+  std::basic_ostream<Char,Traits>&
+  operator <<(std::basic_ostream<Char,Traits>& os,
+             const ImmutableArray<T>& x) {
+    std::basic_ostringstream<Char,Traits> s;
+    s.copyfmt(os); s.width(0);
+    s << '{';
+    if (x.size() > 0) {
+      s << x[0];
+      for (int i=1; i<x.size(); i++)
+        s << ", " << x[i];
+    }
+    s << '}';
+    return os << s.str();
+  }
+
+}
+
+// STATISTICS: kernel-other
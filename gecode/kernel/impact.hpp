@@ -0,0 +1,373 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode {
+
+  /**
+   * \brief Class for impact information
+   *
+   * For each variable and each value of its initial domain, the
+   * impact of assigning the variable to the value is maintained.
+   * The impact is the relative reduction of the search space (the
+   * product of the domain sizes) that results from the assignment
+   * together with the propagation it triggers: an impact of zero
+   * means that nothing has been pruned, an impact of one means that
+   * the assignment has failed. The impact information is the average
+   * of all impacts observed so far.
+   *
+   * Impacts are observed by branchings using impacts for value
+   * selection and optionally by probing each variable-value pair
+   * when the first choice is computed.
+   *
+   */
+  class Impact {
+  protected:
+    template<class View>
+    class Observer;
+    /// Object for storing impact information
+    class Storage {
+    public:
+      /// Mutex to synchronize globally shared access
+      Support::Mutex m;
+      /// How many references exist for this object
+      unsigned int use_cnt;
+      /// Number of variables
+      int n;
+      /// Smallest value of the initial domain for each variable
+      int* min;
+      /// Start of impacts for each variable (and end for the last)
+      int* start;
+      /// Impacts
+      double* imp;
+      /// Number of observations for each impact
+      unsigned int* cnt;
+      /// Whether probing is still to be done
+      bool probe;
+      /// Allocate for \a n0 variables with smallest values \a min0 and largest values \a max0
+      Storage(int n0, const int* min0, const int* max0, bool probe0);
+      /// Delete object
+      ~Storage(void);
+      /// Allocate memory from heap
+      static void* operator new(size_t s);
+      /// Free memory allocated from heap
+      static void  operator delete(void* p);
+    };
+
+    /// Pointer to storage object
+    Storage* storage;
+    /// Acquire mutex
+    void acquire(void);
+    /// Release mutex
+    void release(void);
+    /**
+     * \brief Initialize for \a n variables with smallest values \a min and largest values \a max
+     *
+     * This member function can only be used once and only if the
+     * impact storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_KERNEL_EXPORT
+    void init(int n, const int* min, const int* max, bool probe);
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized impact storage is init and the assignment operator.
+     *
+     */
+    Impact(void);
+    /// Copy constructor
+    GECODE_KERNEL_EXPORT
+    Impact(const Impact& a);
+    /// Assignment operator
+    GECODE_KERNEL_EXPORT
+    Impact& operator =(const Impact& a);
+    /// Initialize for views \a x, probe at first choice if \a probe is true
+    template<class View>
+    Impact(Home home, ViewArray<View>& x, bool probe);
+    /// Initialize for views \a x, probe at first choice if \a probe is true
+    template<class View>
+    void init(Home home, ViewArray<View>& x, bool probe);
+    /// Test whether already initialized
+    bool initialized(void) const;
+    /// Default (empty) impact information
+    GECODE_KERNEL_EXPORT static const Impact def;
+    //@}
+
+    /// \name Update and delete impact information
+    //@{
+    /// Updating during cloning
+    GECODE_KERNEL_EXPORT
+    void update(Space& home, bool share, Impact& a);
+    /// Record impact \a r of assigning the view at position \a i to \a v
+    GECODE_KERNEL_EXPORT
+    void update(int i, int v, double r);
+    /**
+     * \brief Observe the impact of assigning view \a x[\a i] to \a v
+     *
+     * Must be called before the assignment is performed. The impact
+     * is recorded when propagation after the assignment has reached
+     * a fixpoint or has failed.
+     *
+     */
+    template<class View>
+    void observe(Home home, ViewArray<View>& x, int i, int v);
+    /// Return whether probing must be done (returns true only once)
+    GECODE_KERNEL_EXPORT
+    bool probe(void);
+    /// Destructor
+    GECODE_KERNEL_EXPORT
+    ~Impact(void);
+    //@}
+    
+    /// \name Information access
+    //@{
+    /// Return impact of assigning the view at position \a i to \a v
+    double operator ()(int i, int v) const;
+    /// Return number of views
+    int size(void) const;
+    /// Return logarithm of search space size for views \a x
+    template<class View>
+    static double logsize(const ViewArray<View>& x);
+    //@}
+  };
+
+  /// Propagator for observing the impact of a single assignment
+  template<class View>
+  class Impact::Observer : public Propagator {
+  protected:
+    /// The views
+    ViewArray<View> x;
+    /// Access to impact information
+    Impact impact;
+    /// Position of assigned view
+    int i;
+    /// Value assigned to
+    int v;
+    /// Logarithm of search space size before the assignment
+    double l;
+    /// Constructor for cloning \a p
+    Observer(Space& home, bool share, Observer<View>& p);
+  public:
+    /// Constructor for creation
+    Observer(Home home, ViewArray<View>& x, Impact& impact, int i, int v);
+    /// Copy propagator during cloning
+    virtual Propagator* copy(Space& home, bool share);
+    /// Cost function (crazy so that propagator is likely to run last)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Record impact and become subsumed
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Record failure
+    virtual void failed(Space& home, const Propagator& p);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+
+  /*
+   * Impact value storage
+   *
+   */
+  forceinline void*
+  Impact::Storage::operator new(size_t s) {
+    return Gecode::heap.ralloc(s);
+  }
+  forceinline void
+  Impact::Storage::operator delete(void* p) {
+    Gecode::heap.rfree(p);
+  }
+  forceinline
+  Impact::Storage::Storage(int n0, const int* min0, const int* max0,
+                           bool probe0)
+    : use_cnt(1), n(n0), min(heap.alloc<int>(n0)), 
+      start(heap.alloc<int>(n0+1)), probe(probe0) {
+    start[0] = 0;
+    for (int i=0; i<n; i++) {
+      min[i] = min0[i];
+      start[i+1] = start[i] + (max0[i] - min0[i] + 1);
+    }
+    imp = heap.alloc<double>(start[n]);
+    cnt = heap.alloc<unsigned int>(start[n]);
+    for (int i=start[n]; i--; ) {
+      imp[i] = 0.0; cnt[i] = 0U;
+    }
+  }
+  forceinline
+  Impact::Storage::~Storage(void) {
+    heap.free<double>(imp,start[n]);
+    heap.free<unsigned int>(cnt,start[n]);
+    heap.free<int>(min,n);
+    heap.free<int>(start,n+1);
+  }
+
+
+  /*
+   * Impact
+   *
+   */
+
+  forceinline double
+  Impact::operator ()(int i, int v) const {
+    assert(storage != NULL);
+    assert((i >= 0) && (i < storage->n));
+    int j = storage->start[i] + (v - storage->min[i]);
+    if ((j < storage->start[i]) || (j >= storage->start[i+1]))
+      return 0.0;
+    return storage->imp[j];
+  }
+  forceinline int
+  Impact::size(void) const {
+    return storage->n;
+  }
+  forceinline void
+  Impact::acquire(void) {
+    storage->m.acquire();
+  }
+  forceinline void
+  Impact::release(void) {
+    storage->m.release();
+  }
+
+  template<class View>
+  forceinline double
+  Impact::logsize(const ViewArray<View>& x) {
+    double l = 0.0;
+    for (int i=x.size(); i--; )
+      l += std::log(static_cast<double>(x[i].size()));
+    return l;
+  }
+
+
+  forceinline
+  Impact::Impact(void) : storage(NULL) {}
+
+  forceinline bool
+  Impact::initialized(void) const {
+    return storage != NULL;
+  }
+
+  template<class View>
+  forceinline
+  Impact::Impact(Home home, ViewArray<View>& x, bool probe)
+    : storage(NULL) {
+    init(home,x,probe);
+  }
+  template<class View>
+  forceinline void
+  Impact::init(Home home, ViewArray<View>& x, bool probe) {
+    Region r(home);
+    int* min = r.alloc<int>(x.size());
+    int* max = r.alloc<int>(x.size());
+    for (int i=x.size(); i--; ) {
+      min[i] = x[i].min(); max[i] = x[i].max();
+    }
+    init(x.size(),min,max,probe);
+  }
+
+  template<class View>
+  forceinline void
+  Impact::observe(Home home, ViewArray<View>& x, int i, int v) {
+    (void) new (home) Observer<View>(home,x,*this,i,v);
+  }
+
+
+  /*
+   * Observer propagator
+   *
+   */
+  template<class View>
+  forceinline
+  Impact::Observer<View>::Observer(Home home, ViewArray<View>& x0, 
+                                   Impact& impact0, int i0, int v0)
+    : Propagator(home), x(x0), impact(impact0), i(i0), v(v0),
+      l(Impact::logsize(x0)) {
+    home.notice(*this,AP_DISPOSE);
+    home.notice(*this,AP_FAILURE);
+    View::schedule(home,*this,ME_GEN_ASSIGNED);
+  }
+
+  template<class View>
+  forceinline
+  Impact::Observer<View>::Observer(Space& home, bool share,
+                                   Observer<View>& p) 
+    : Propagator(home,share,p), i(p.i), v(p.v), l(p.l) {
+    x.update(home, share, p.x);
+    impact.update(home, share, p.impact);
+  }
+
+  template<class View>
+  Propagator*
+  Impact::Observer<View>::copy(Space& home, bool share) {
+    return new (home) Observer<View>(home, share, *this);
+  }
+
+  template<class View>
+  inline size_t
+  Impact::Observer<View>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    home.ignore(*this,AP_FAILURE);
+    impact.~Impact();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View>
+  PropCost 
+  Impact::Observer<View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::crazy(PropCost::HI,1000);
+  }
+
+  template<class View>
+  ExecStatus
+  Impact::Observer<View>::propagate(Space& home, const ModEventDelta&) {
+    impact.update(i,v,1.0 - std::exp(Impact::logsize(x) - l));
+    return home.ES_SUBSUMED(*this);
+  }
+
+  template<class View>
+  void
+  Impact::Observer<View>::failed(Space&, const Propagator&) {
+    impact.update(i,v,1.0);
+  }
+
+}
+
+// STATISTICS: kernel-branch
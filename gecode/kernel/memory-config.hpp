@@ -39,13 +39,40 @@ namespace Gecode {
 
   /**
    * \brief Parameters defining memory management policy for spaces
+   *
+   * The parameters define the defaults for the runtime parameters
+   * in Gecode::MemoryOptions.
    * \ingroup FuncMemSpace
    */
   namespace MemoryConfig {
     /**
-     * \brief How many heap chunks should be cached at most
+     * \brief How many heap chunks should be cached at least
+     *
+     * The heap chunks are cached by the shared memory object of all
+     * spaces of a search worker. The cache always accepts \a n_hc_cache
+     * heap chunks, further heap chunks are only cached as long as the
+     * cache does not exceed the size of the chunks of the largest space
+     * that has been deleted (see \a hc_cache_size_max).
      */
     const unsigned int n_hc_cache = 4*4;
+    /**
+     * \brief Maximal size of all cached heap chunks
+     *
+     * The cache grows to hold all heap chunks of the largest space that
+     * has been deleted, so that the heap chunks of a deleted space can
+     * be recycled by the next clone. The size of the cache is bounded
+     * by \a hc_cache_size_max.
+     */
+    const size_t hc_cache_size_max = 16 * 1024 * 1024;
+    /**
+     * \brief Number of size classes for cached heap chunks
+     *
+     * The size class \f$i\f$ contains heap chunks of size between
+     * \f$2^i\cdot\mathtt{hcsz\_min}\f$ and
+     * \f$2^{i+1}\cdot\mathtt{hcsz\_min}\f$, the last class contains all
+     * larger heap chunks.
+     */
+    const int hc_n_class = 8;
 
     /**
      * \brief Minimal size of a heap chunk requested from the OS
@@ -57,6 +84,9 @@ namespace Gecode {
      * Maximal is not strictly true, if a contiguous memory chunk is
      * requested that exceeds \a hcsz_max, a chunk will be allocated
      * that fits that request.
+     *
+     * If the heap prefers larger chunks (for example, chunks backed by
+     * huge pages, see Heap::chunk_size), heap chunks grow up to that size.
      */
     const size_t hcsz_max = 64 * 1024;
     /**
@@ -131,6 +161,9 @@ namespace Gecode {
      * The region area can be used in a stack fashion through access
      * from a space. If the a request exceeds the current free space,
      * memory will be allocated from the heap.
+     *
+     * This is also the maximal size of the region area that can be
+     * set at runtime.
      */
     const size_t region_area_size = 32 * 1024;
 
@@ -149,6 +182,157 @@ namespace Gecode {
     }
 
   }
+
+  /**
+   * \brief Statistics for memory management of spaces
+   *
+   * Statistics are only recorded if requested by the memory options
+   * of a space (see MemoryOptions::stat).
+   * \ingroup FuncMemSpace
+   */
+  class MemoryStatistics {
+  public:
+    /// Number of size classes for allocations
+    static const int n_size = 16;
+    /// Number of free list sizes
+    static const int n_fl =
+      MemoryConfig::fl_size_max-MemoryConfig::fl_size_min+1;
+    /**
+     * \brief Number of allocations by size class
+     *
+     * The size class \f$i\f$ counts allocations of at least
+     * \f$2^i\f$ and less than \f$2^{i+1}\f$ bytes, the last class
+     * counts all larger allocations.
+     */
+    unsigned long int alloc[n_size];
+    /// Number of free list allocations served from the free list
+    unsigned long int fl_hit[n_fl];
+    /// Number of free list allocations that required to refill the free list
+    unsigned long int fl_miss[n_fl];
+    /// Number of allocations from the region area
+    unsigned long int region;
+    /// Number of region allocations that overflowed to the heap
+    unsigned long int region_overflow;
+    /// Number of heap chunks allocated from the heap
+    unsigned long int hc_alloc;
+    /// Number of heap chunks recycled from the cache of heap chunks
+    unsigned long int hc_reuse;
+    /// Initialize
+    MemoryStatistics(void);
+    /// Reset information
+    void reset(void);
+    /// Record allocation of \a s bytes
+    void allocated(size_t s);
+    /// Add statistics \a s
+    MemoryStatistics& operator +=(const MemoryStatistics& s);
+  };
+
+  /**
+   * \brief Runtime parameters for memory management of spaces
+   *
+   * The parameters are initialized from the defaults in
+   * Gecode::MemoryConfig. They are used by all spaces that share
+   * memory with each other and are inherited by clones (see
+   * Space::memory).
+   * \ingroup FuncMemSpace
+   */
+  class MemoryOptions {
+  public:
+    /// How many heap chunks should be cached at least
+    unsigned int n_hc_cache;
+    /// Maximal size of all cached heap chunks
+    size_t hc_cache_size_max;
+    /// Minimal size of a heap chunk requested from the OS
+    size_t hcsz_min;
+    /// Maximal size of a heap chunk requested from the OS
+    size_t hcsz_max;
+    /// Increment ratio for chunk size
+    int hcsz_inc_ratio;
+    /// Decrement ratio for chunk size
+    int hcsz_dec_ratio;
+    /// Number of free lists elements to allocate (at least two)
+    int fl_refill;
+    /// Size of region area (at most MemoryConfig::region_area_size)
+    size_t region_area_size;
+    /**
+     * \brief Whether clones group propagators by cost
+     *
+     * If true, cloning copies propagators (together with their
+     * advisors) grouped by their cost, cheapest first, and within a
+     * group in order of their most recent execution. As a result,
+     * propagators that are likely to run together are placed next
+     * to each other in memory. The order of propagators in the
+     * clone is not changed.
+     */
+    bool group;
+    /**
+     * \brief Where to record statistics (no statistics if NULL)
+     *
+     * The statistics are recorded per shared memory object (that is,
+     * for all spaces of a search worker) and are added to \a stat
+     * when the last space using the shared memory object is deleted.
+     */
+    MemoryStatistics* stat;
+    /// Initialize with default values
+    MemoryOptions(void);
+  };
+
+
+  /*
+   * Memory statistics
+   *
+   */
+  forceinline void
+  MemoryStatistics::reset(void) {
+    for (int i=n_size; i--; )
+      alloc[i] = 0;
+    for (int i=n_fl; i--; ) {
+      fl_hit[i] = 0; fl_miss[i] = 0;
+    }
+    region = 0; region_overflow = 0;
+    hc_alloc = 0; hc_reuse = 0;
+  }
+  forceinline
+  MemoryStatistics::MemoryStatistics(void) {
+    reset();
+  }
+  forceinline void
+  MemoryStatistics::allocated(size_t s) {
+    int i = 0;
+    while ((s > 1) && (i < n_size-1)) {
+      s >>= 1; i++;
+    }
+    alloc[i]++;
+  }
+  forceinline MemoryStatistics&
+  MemoryStatistics::operator +=(const MemoryStatistics& s) {
+    for (int i=n_size; i--; )
+      alloc[i] += s.alloc[i];
+    for (int i=n_fl; i--; ) {
+      fl_hit[i] += s.fl_hit[i]; fl_miss[i] += s.fl_miss[i];
+    }
+    region += s.region; region_overflow += s.region_overflow;
+    hc_alloc += s.hc_alloc; hc_reuse += s.hc_reuse;
+    return *this;
+  }
+
+
+  /*
+   * Memory options
+   *
+   */
+  forceinline
+  MemoryOptions::MemoryOptions(void)
+    : n_hc_cache(MemoryConfig::n_hc_cache),
+      hc_cache_size_max(MemoryConfig::hc_cache_size_max),
+      hcsz_min(MemoryConfig::hcsz_min),
+      hcsz_max(MemoryConfig::hcsz_max),
+      hcsz_inc_ratio(MemoryConfig::hcsz_inc_ratio),
+      hcsz_dec_ratio(MemoryConfig::hcsz_dec_ratio),
+      fl_refill(MemoryConfig::fl_refill),
+      region_area_size(MemoryConfig::region_area_size),
+      group(false), stat(NULL) {}
+
 }
 
 // STATISTICS: kernel-core
@@ -46,6 +46,40 @@ namespace Gecode {
     alloc_fill(sm,sz,false);
   }
 
+  /// Mutex for adding statistics of shared memory objects
+  static Support::Mutex stat_m;
+
+  void
+  SharedMemory::stat_flush(void) {
+    if (opt.stat != NULL) {
+      Support::Lock l(stat_m);
+      *opt.stat += *ms;
+    }
+    ms->reset();
+  }
+
+  void
+  SharedMemory::options(const MemoryOptions& o) {
+    // Pass on recorded statistics before they might get lost
+    if (ms != NULL) {
+      stat_flush();
+      if (o.stat == NULL) {
+        Gecode::heap.free<MemoryStatistics>(ms,1); ms = NULL;
+      }
+    } else if (o.stat != NULL) {
+      ms = Gecode::heap.alloc<MemoryStatistics>(1);
+    }
+    // Adapt region area only if it is not in use
+    bool unused = (region.free == opt.region_area_size);
+    opt = o;
+    if (opt.region_area_size > MemoryConfig::region_area_size)
+      opt.region_area_size = MemoryConfig::region_area_size;
+    if (opt.fl_refill < 2)
+      opt.fl_refill = 2;
+    if (unused)
+      region.free = opt.region_area_size;
+  }
+
 }
 
 // STATISTICS: kernel-core
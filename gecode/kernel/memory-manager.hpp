@@ -53,6 +53,8 @@ namespace Gecode {
   /// Memory chunk allocated from heap with proper alignment
   class HeapChunk : public MemoryChunk {
   public:
+    /// Whether the chunk has been mapped rather than allocated
+    bool mapped;
     /// Start of memory area inside chunk
     double area[1];
   };
@@ -65,6 +67,12 @@ namespace Gecode {
   private:
     /// How many spaces use this shared memory object
     unsigned int use_cnt;
+    /// The runtime parameters for memory management
+    MemoryOptions opt;
+    /// Statistics (NULL if no statistics are recorded)
+    MemoryStatistics* ms;
+    /// Add statistics to the statistics requested by the options
+    GECODE_KERNEL_EXPORT void stat_flush(void);
     /// The components for the shared region area
     struct {
       /// Amount of free memory
@@ -74,29 +82,56 @@ namespace Gecode {
     } region;
     /// The components for shared heap memory
     struct {
-      /// How many heap chunks are available for caching
+      /// How many heap chunks are cached
       unsigned int n_hc;
-      /// A list of cached heap chunks
-      HeapChunk* hc;
+      /// Total size of cached heap chunks
+      size_t s_hc;
+      /// Maximal total size of cached heap chunks
+      size_t s_max;
+      /// Lists of cached heap chunks by size class
+      HeapChunk* hc[MemoryConfig::hc_n_class];
+      /// How many heap chunks have been allocated from the heap
+      unsigned long int n_alloc;
+      /// How many heap chunks have been recycled from the cache
+      unsigned long int n_reuse;
     } heap;
+    /// Return size class for heap chunk of size \a s
+    static int hc_class(size_t s);
   public:
     /// Initialize
     SharedMemory(void);
+    /// Initialize with runtime parameters \a o
+    SharedMemory(const MemoryOptions& o);
     /// Flush all cached memory
     void flush(void);
     /// Destructor
     ~SharedMemory(void);
     /// \name Region management
-    //@
+    //@{
     /// Return memory chunk if available
     bool region_alloc(size_t s, void*& p);
     //@}
     /// \name Heap management
-    //@
+    //@{
     /// Return heap chunk, preferable of size \a s, but at least of size \a l
     HeapChunk* heap_alloc(size_t s, size_t l);
     /// Free heap chunk (or cache for later)
     void heap_free(HeapChunk* hc);
+    /// Adapt cache size to the heap chunks of size \a s of a deleted space
+    void heap_release(size_t s);
+    /// Return how many heap chunks have been allocated from the heap
+    unsigned long int hc_alloc(void) const;
+    /// Return how many heap chunks have been recycled from the cache
+    unsigned long int hc_reuse(void) const;
+    //@}
+    /// \name Runtime parameters and statistics
+    //@{
+    /// Set runtime parameters to \a o
+    GECODE_KERNEL_EXPORT void options(const MemoryOptions& o);
+    /// Return runtime parameters
+    const MemoryOptions& options(void) const;
+    /// Return statistics (NULL if no statistics are recorded)
+    MemoryStatistics* statistics(void) const;
     //@}
     /// Return copy during cloning
     SharedMemory* copy(bool share);
@@ -136,6 +171,7 @@ namespace Gecode {
 
   /// Manage memory for space
   class MemoryManager {
+    friend class Trail;
   public:
     /// Constructor initialization
     MemoryManager(SharedMemory* sm);
@@ -143,6 +179,8 @@ namespace Gecode {
     MemoryManager(SharedMemory* sm, MemoryManager& mm, size_t s_sub);
     /// Release all allocated heap chunks
     void release(SharedMemory* sm);
+    /// Take over all heap chunks of \a mm
+    void merge(MemoryManager& mm);
 
   private:
     size_t     cur_hcsz;  ///< Current heap chunk size
@@ -207,23 +245,48 @@ namespace Gecode {
   }
   forceinline
   SharedMemory::SharedMemory(void)
-    : use_cnt(1) {
-    region.free = MemoryConfig::region_area_size;
+    : use_cnt(1), ms(NULL) {
+    region.free = opt.region_area_size;
+    heap.n_hc = 0;
+    heap.s_hc = 0;
+    heap.s_max = 0;
+    for (int i=MemoryConfig::hc_n_class; i--; )
+      heap.hc[i] = NULL;
+    heap.n_alloc = 0;
+    heap.n_reuse = 0;
+  }
+  forceinline
+  SharedMemory::SharedMemory(const MemoryOptions& o)
+    : use_cnt(1), opt(o), ms(NULL) {
+    if (opt.stat != NULL)
+      ms = Gecode::heap.alloc<MemoryStatistics>(1);
+    region.free = opt.region_area_size;
     heap.n_hc = 0;
-    heap.hc = NULL;
+    heap.s_hc = 0;
+    heap.s_max = 0;
+    for (int i=MemoryConfig::hc_n_class; i--; )
+      heap.hc[i] = NULL;
+    heap.n_alloc = 0;
+    heap.n_reuse = 0;
   }
   forceinline void
   SharedMemory::flush(void) {
     heap.n_hc = 0;
-    while (heap.hc != NULL) {
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-      Gecode::heap.rfree(hc);
-    }
+    heap.s_hc = 0;
+    for (int i=MemoryConfig::hc_n_class; i--; )
+      while (heap.hc[i] != NULL) {
+        HeapChunk* hc = heap.hc[i];
+        heap.hc[i] = static_cast<HeapChunk*>(hc->next);
+        Gecode::heap.chunk_free(hc,hc->size,hc->mapped);
+      }
   }
   forceinline
   SharedMemory::~SharedMemory(void) {
     flush();
+    if (ms != NULL) {
+      stat_flush();
+      Gecode::heap.free<MemoryStatistics>(ms,1);
+    }
   }
   forceinline SharedMemory*
   SharedMemory::copy(bool share) {
@@ -231,9 +294,17 @@ namespace Gecode {
       use_cnt++;
       return this;
     } else {
-      return new SharedMemory();
+      return new SharedMemory(opt);
     }
   }
+  forceinline const MemoryOptions&
+  SharedMemory::options(void) const {
+    return opt;
+  }
+  forceinline MemoryStatistics*
+  SharedMemory::statistics(void) const {
+    return ms;
+  }
   forceinline bool
   SharedMemory::release(void) {
     return --use_cnt == 0;
@@ -241,41 +312,85 @@ namespace Gecode {
   forceinline bool
   SharedMemory::region_alloc(size_t s, void*& p) {
     MemoryConfig::align(s);
-    if (s > region.free)
+    if (s > region.free) {
+      if (ms != NULL)
+        ms->region_overflow++;
       return false;
+    }
+    if (ms != NULL)
+      ms->region++;
     region.free -= s;
     p = Support::ptr_cast<char*>(&region.area[0]) + region.free;
     return true;
   }
+  forceinline int
+  SharedMemory::hc_class(size_t s) {
+    int i = 0;
+    s /= MemoryConfig::hcsz_min;
+    while ((s > 1) && (i < MemoryConfig::hc_n_class-1)) {
+      s >>= 1; i++;
+    }
+    return i;
+  }
   forceinline HeapChunk*
   SharedMemory::heap_alloc(size_t s, size_t l) {
-    while ((heap.hc != NULL) && (heap.hc->size < l)) {
-      heap.n_hc--;
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-      Gecode::heap.rfree(hc);
-    }
-    if (heap.hc == NULL) {
-      assert(heap.n_hc == 0);
-      HeapChunk* hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
-      hc->size = s;
-      return hc;
-    } else {
-      heap.n_hc--;
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-      return hc;
-    }
+    int i = hc_class(s);
+    // Search for a sufficiently large chunk in the class for s
+    for (HeapChunk* p = NULL, * hc = heap.hc[i]; hc != NULL;
+         p = hc, hc = static_cast<HeapChunk*>(hc->next))
+      if (hc->size >= l) {
+        if (p == NULL)
+          heap.hc[i] = static_cast<HeapChunk*>(hc->next);
+        else
+          p->next = hc->next;
+        heap.n_hc--; heap.s_hc -= hc->size; heap.n_reuse++;
+        if (ms != NULL)
+          ms->hc_reuse++;
+        return hc;
+      }
+    // All chunks in larger classes are sufficiently large
+    while (++i < MemoryConfig::hc_n_class)
+      if (heap.hc[i] != NULL) {
+        HeapChunk* hc = heap.hc[i];
+        heap.hc[i] = static_cast<HeapChunk*>(hc->next);
+        heap.n_hc--; heap.s_hc -= hc->size; heap.n_reuse++;
+        if (ms != NULL)
+          ms->hc_reuse++;
+        return hc;
+      }
+    bool m;
+    HeapChunk* hc = static_cast<HeapChunk*>(Gecode::heap.chunk_alloc(s,m));
+    hc->size = s; hc->mapped = m; heap.n_alloc++;
+    if (ms != NULL)
+      ms->hc_alloc++;
+    return hc;
   }
   forceinline void
   SharedMemory::heap_free(HeapChunk* hc) {
-    if (heap.n_hc == MemoryConfig::n_hc_cache) {
-      Gecode::heap.rfree(hc);
+    if ((heap.n_hc >= opt.n_hc_cache) &&
+        (heap.s_hc + hc->size > heap.s_max)) {
+      Gecode::heap.chunk_free(hc,hc->size,hc->mapped);
     } else {
-      heap.n_hc++;
-      hc->next = heap.hc; heap.hc = hc;
+      int i = hc_class(hc->size);
+      heap.n_hc++; heap.s_hc += hc->size;
+      hc->next = heap.hc[i]; heap.hc[i] = hc;
     }
   }
+  forceinline void
+  SharedMemory::heap_release(size_t s) {
+    if (s > opt.hc_cache_size_max)
+      s = opt.hc_cache_size_max;
+    if (s > heap.s_max)
+      heap.s_max = s;
+  }
+  forceinline unsigned long int
+  SharedMemory::hc_alloc(void) const {
+    return heap.n_alloc;
+  }
+  forceinline unsigned long int
+  SharedMemory::hc_reuse(void) const {
+    return heap.n_reuse;
+  }
 
 
   /*
@@ -333,6 +448,8 @@ namespace Gecode {
     assert(sz > 0);
     // Perform alignment
     MemoryConfig::align(sz);
+    if (MemoryStatistics* s = sm->statistics())
+      s->allocated(sz);
     // Check whether sufficient memory left
     if (sz > lsz)
       alloc_refill(sm,sz);
@@ -348,9 +465,11 @@ namespace Gecode {
   forceinline void
   MemoryManager::alloc_fill(SharedMemory* sm, size_t sz, bool first) {
     // Adjust current heap chunk size
-    if (((requested > MemoryConfig::hcsz_inc_ratio*cur_hcsz) ||
+    const MemoryOptions& o = sm->options();
+    if (((requested > o.hcsz_inc_ratio*cur_hcsz) ||
          (sz > cur_hcsz)) &&
-        (cur_hcsz < MemoryConfig::hcsz_max)) {
+        ((cur_hcsz < o.hcsz_max) ||
+         (cur_hcsz < Gecode::heap.chunk_size()))) {
       cur_hcsz <<= 1;
     }
     // Increment the size that it caters for the initial overhead
@@ -379,7 +498,7 @@ namespace Gecode {
 
   forceinline
   MemoryManager::MemoryManager(SharedMemory* sm)
-    : cur_hcsz(MemoryConfig::hcsz_min), requested(0), slack(NULL) {
+    : cur_hcsz(sm->options().hcsz_min), requested(0), slack(NULL) {
     alloc_fill(sm,cur_hcsz,true);
     for (size_t i = MemoryConfig::fl_size_max-MemoryConfig::fl_size_min+1;
          i--; )
@@ -391,8 +510,8 @@ namespace Gecode {
                                size_t s_sub)
     : cur_hcsz(mm.cur_hcsz), requested(0), slack(NULL) {
     MemoryConfig::align(s_sub);
-    if ((mm.requested < MemoryConfig::hcsz_dec_ratio*mm.cur_hcsz) &&
-        (cur_hcsz > MemoryConfig::hcsz_min) &&
+    if ((mm.requested < sm->options().hcsz_dec_ratio*mm.cur_hcsz) &&
+        (cur_hcsz > sm->options().hcsz_min) &&
         (s_sub*2 < cur_hcsz))
       cur_hcsz >>= 1;
     alloc_fill(sm,cur_hcsz+s_sub,true);
@@ -406,12 +525,29 @@ namespace Gecode {
 
   forceinline void
   MemoryManager::release(SharedMemory* sm) {
+    // Make sure that all heap chunks can be recycled by the next clone
+    sm->heap_release(requested);
     // Release all allocated heap chunks
     HeapChunk* hc = cur_hc;
-    do {
+    while (hc != NULL) {
       HeapChunk* t = hc; hc = static_cast<HeapChunk*>(hc->next);
       sm->heap_free(t);
-    } while (hc != NULL);
+    }
+  }
+
+  forceinline void
+  MemoryManager::merge(MemoryManager& mm) {
+    // Link heap chunks of mm after the first heap chunk
+    HeapChunk* hc = mm.cur_hc;
+    while (hc->next != NULL)
+      hc = static_cast<HeapChunk*>(hc->next);
+    hc->next = cur_hc->next; cur_hc->next = mm.cur_hc;
+    requested += mm.requested;
+    mm.cur_hc = NULL; mm.requested = 0;
+    mm.lsz = 0; mm.slack = NULL;
+    for (size_t i = MemoryConfig::fl_size_max-MemoryConfig::fl_size_min+1;
+         i--; )
+      mm.fl[i] = NULL;
   }
 
 
@@ -456,6 +592,12 @@ namespace Gecode {
   MemoryManager::fl_alloc(SharedMemory* sm) {
     size_t i = sz2i(s);
     FreeList* f = fl[i];
+    if (MemoryStatistics* ms = sm->statistics()) {
+      if (f == NULL)
+        ms->fl_miss[i]++;
+      else
+        ms->fl_hit[i]++;
+    }
     if (f == NULL) {
       fl_refill<s>(sm); f = fl[i];
     }
@@ -493,15 +635,15 @@ namespace Gecode {
         Support::ptr_cast<FreeList*>(block)->next(NULL);
       } while (m != NULL);
     } else {
-      char* block = static_cast<char*>(alloc(sm,MemoryConfig::fl_refill*sz));
+      int n = sm->options().fl_refill;
+      char* block = static_cast<char*>(alloc(sm,n*sz));
       fl[sz2i(sz)] = Support::ptr_cast<FreeList*>(block);
-      int i = MemoryConfig::fl_refill-2;
+      int i = n-2;
       do {
         Support::ptr_cast<FreeList*>(block+i*sz)->next
           (Support::ptr_cast<FreeList*>(block+(i+1)*sz));
       } while (--i >= 0);
-      Support::ptr_cast<FreeList*>(block+
-                                   (MemoryConfig::fl_refill-1)*sz)->next
+      Support::ptr_cast<FreeList*>(block+(n-1)*sz)->next
         (Support::ptr_cast<FreeList*>(NULL));
     }
   }
@@ -0,0 +1,414 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+
+namespace Gecode {
+
+  /*
+   * Partition of propagators
+   *
+   */
+  PropPartition::PropPartition(unsigned int n, bool c0)
+    : t(NULL), mask(0), n_e(0), up(NULL), n_g(0), s_g(0), n_t(n), c(c0) {}
+
+  PropPartition::~PropPartition(void) {
+    if (t != NULL)
+      heap.free<Entry>(t,mask+1);
+    if (up != NULL)
+      heap.free<unsigned int>(up,s_g);
+  }
+
+  forceinline PropPartition::Entry&
+  PropPartition::entry(const Actor* a) const {
+    size_t h = reinterpret_cast<size_t>(a);
+    unsigned int i = static_cast<unsigned int>((h >> 4) ^ (h >> 12)) & mask;
+    while ((t[i].a != NULL) && (t[i].a != a))
+      i = (i+1) & mask;
+    return t[i];
+  }
+
+  void
+  PropPartition::resize(void) {
+    unsigned int m = (t == NULL) ? 63 : 2*mask+1;
+    Entry* o = t;
+    unsigned int n = (t == NULL) ? 0 : mask+1;
+    t = heap.alloc<Entry>(m+1); mask = m;
+    for (unsigned int i=0; i<=m; i++)
+      t[i].a = NULL;
+    for (unsigned int i=0; i<n; i++)
+      if (o[i].a != NULL)
+        entry(o[i].a) = o[i];
+    if (o != NULL)
+      heap.free<Entry>(o,n);
+  }
+
+  forceinline unsigned int
+  PropPartition::root(unsigned int g) {
+    // Path halving
+    while (up[g] != g) {
+      up[g] = up[up[g]]; g = up[g];
+    }
+    return g;
+  }
+
+  forceinline unsigned int
+  PropPartition::group(const Actor* a) {
+    if ((t == NULL) || (2*n_e > mask))
+      resize();
+    Entry& e = entry(a);
+    if (e.a == NULL) {
+      if (n_g == s_g) {
+        unsigned int s = (s_g == 0) ? 64 : 2*s_g;
+        up = heap.realloc<unsigned int>(up,s_g,s);
+        s_g = s;
+      }
+      e.a = a; e.g = n_g; up[n_g] = n_g; n_g++; n_e++;
+    }
+    return e.g;
+  }
+
+  void
+  PropPartition::unite(const Actor* a, const Actor* b) {
+    unsigned int g = root(group(a));
+    unsigned int h = root(group(b));
+    if (g != h)
+      up[g] = h;
+  }
+
+  int
+  PropPartition::find(const Actor* a) {
+    if (t == NULL)
+      return -1;
+    Entry& e = entry(a);
+    return (e.a == NULL) ? -1 : static_cast<int>(root(e.g));
+  }
+
+  void
+  PropPartition::unite(PropPartition& p) {
+    if (p.t == NULL)
+      return;
+    // First propagator found for each group of p
+    const Actor** f = heap.alloc<const Actor*>(p.n_g);
+    for (unsigned int i=0; i<p.n_g; i++)
+      f[i] = NULL;
+    for (unsigned int i=0; i<=p.mask; i++)
+      if (p.t[i].a != NULL) {
+        unsigned int g = p.root(p.t[i].g);
+        if (f[g] == NULL)
+          f[g] = p.t[i].a;
+        else
+          unite(f[g],p.t[i].a);
+      }
+    heap.free<const Actor*>(f,p.n_g);
+  }
+
+
+  /*
+   * Shadow spaces for parallel propagation
+   *
+   */
+
+  /**
+   * \brief Space that propagates a part of the propagators of a space
+   *
+   * A shadow space takes over the propagators of some groups of a
+   * space, propagates them (possibly in a different thread), and
+   * then hands them back. All memory allocated by the shadow space
+   * is handed back as well.
+   */
+  class Space::Shadow : public Space {
+  public:
+    /// Runnable object for propagating a shadow space
+    class Worker : public Support::Runnable {
+    public:
+      /// The shadow space
+      Shadow& s;
+      /// Initialize for shadow space \a s0
+      Worker(Shadow& s0) : s(s0) {}
+      /// Propagate
+      virtual void run(void);
+    };
+    /// Mutex for counting how many workers are still running
+    Support::Mutex* m;
+    /// Event to signal that all workers are done
+    Support::Event* e;
+    /// How many workers are still running
+    unsigned int* n;
+    /// Statistics for propagation
+    StatusStatistics stat;
+    /// Result of propagation
+    SpaceStatus ss;
+    /// Initialize for space \a home
+    Shadow(Space& home, Support::Mutex& m0, Support::Event& e0,
+           unsigned int& n0);
+    /// Propagate and signal when all workers are done
+    void propagate(void);
+    /// Must not be called
+    virtual Space* copy(bool share);
+  };
+
+  Space::Space(Space& home, Shadow*)
+    : sm(new SharedMemory), mm(sm), gpi(home.gpi), tr(NULL), sig(NULL),
+      pa(new PropPartition(1,false)), n_wmp(0), adapt(home.adapt), n_enq(0) {
+#ifdef GECODE_HAS_VAR_DISPOSE
+    for (int i=0; i<AllVarConf::idx_d; i++)
+      _vars_d[i] = NULL;
+#endif
+    pl.init();
+    bl.init();
+    b_status = b_commit = Brancher::cast(&bl);
+    d_fst = d_cur = d_lst = NULL;
+    f_fst = f_cur = f_lst = NULL;
+    pc.p.active = &pc.p.queue[0]-1;
+    for (int i=0; i<=PropCost::AC_MAX; i++)
+      pc.p.queue[i].init();
+    pc.p.branch_id = 0;
+    pc.p.n_sub = 0;
+  }
+
+  Space::Shadow::Shadow(Space& home, Support::Mutex& m0, Support::Event& e0,
+                        unsigned int& n0)
+    : Space(home,this), m(&m0), e(&e0), n(&n0), ss(SS_FAILED) {}
+
+  void
+  Space::Shadow::propagate(void) {
+    ss = status(stat);
+    m->acquire();
+    bool d = (--(*n) == 0);
+    m->release();
+    if (d)
+      e->signal();
+  }
+
+  Space*
+  Space::Shadow::copy(bool) {
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  void
+  Space::Shadow::Worker::run(void) {
+    s.propagate();
+  }
+
+
+  /*
+   * Parallel propagation for spaces
+   *
+   */
+  unsigned int Space::pa_default = 1;
+
+  void
+  Space::parallel_default(unsigned int n) {
+    pa_default = n;
+  }
+
+  void
+  Space::parallel(unsigned int n) {
+    if (n < 2) {
+      delete pa; pa = NULL;
+    } else if (pa != NULL) {
+      pa->threads(n);
+    } else {
+      // The partition is only complete if no propagator has been posted
+      pa = new PropPartition(n,propagators() == 0);
+    }
+  }
+
+  void
+  Space::pa_propagate(StatusStatistics& stat) {
+#if defined(GECODE_HAS_THREADS) && !defined(GECODE_HAS_VAR_DISPOSE)
+    if ((pa->threads() < 2) || !pa->complete() ||
+        (tr != NULL) || (f_cur != f_fst) || (n_wmp != 0))
+      return;
+    // Check whether sufficiently many propagators are scheduled
+    {
+      unsigned int n_s = 0;
+      for (ActorLink* q = &pc.p.queue[0]; q <= pc.p.active; q++)
+        for (ActorLink* a = q->next(); a != q; a = a->next())
+          if (++n_s == PropPartition::n_min)
+            goto enough;
+      return;
+    }
+  enough:
+    Region r(*this);
+    unsigned int n_g = pa->groups();
+    // Number of scheduled propagators per group
+    unsigned int* s = r.alloc<unsigned int>(n_g);
+    for (unsigned int i=0; i<n_g; i++)
+      s[i] = 0;
+    for (ActorLink* q = &pc.p.queue[0]; q <= pc.p.active; q++)
+      for (ActorLink* a = q->next(); a != q; a = a->next()) {
+        int g = pa->find(Propagator::cast(a));
+        if (g >= 0)
+          s[g]++;
+      }
+    // Groups with scheduled propagators, largest first
+    unsigned int n_a = 0;
+    unsigned int* a_g = r.alloc<unsigned int>(n_g);
+    for (unsigned int i=0; i<n_g; i++)
+      if (s[i] > 0)
+        a_g[n_a++] = i;
+    if (n_a < 2)
+      return;
+    for (unsigned int i=1; i<n_a; i++) {
+      unsigned int g = a_g[i];
+      unsigned int j = i;
+      for (; (j > 0) && (s[a_g[j-1]] < s[g]); j--)
+        a_g[j] = a_g[j-1];
+      a_g[j] = g;
+    }
+
+    // Assign groups to shadow spaces, least loaded first
+    unsigned int n_w = std::min(pa->threads(),n_a);
+    int* w = r.alloc<int>(n_g);
+    for (unsigned int i=0; i<n_g; i++)
+      w[i] = -1;
+    unsigned int* l = r.alloc<unsigned int>(n_w);
+    for (unsigned int i=0; i<n_w; i++)
+      l[i] = 0;
+    for (unsigned int i=0; i<n_a; i++) {
+      unsigned int k = 0;
+      for (unsigned int j=1; j<n_w; j++)
+        if (l[j] < l[k])
+          k = j;
+      w[a_g[i]] = static_cast<int>(k); l[k] += s[a_g[i]];
+    }
+
+    Support::Mutex m;
+    Support::Event e;
+    unsigned int n_r = n_w;
+    Shadow** sh = r.alloc<Shadow*>(n_w);
+    for (unsigned int i=0; i<n_w; i++)
+      sh[i] = new Shadow(*this,m,e,n_r);
+
+    // Hand over scheduled propagators
+    for (int c=0; c<=PropCost::AC_MAX; c++) {
+      ActorLink* q = &pc.p.queue[c];
+      ActorLink* a = q->next();
+      while (a != q) {
+        ActorLink* n = a->next();
+        int g = pa->find(Propagator::cast(a));
+        if ((g >= 0) && (w[g] >= 0)) {
+          Shadow& t = *sh[w[g]];
+          a->unlink(); t.pc.p.queue[c].tail(a);
+          if (&t.pc.p.queue[c] > t.pc.p.active)
+            t.pc.p.active = &t.pc.p.queue[c];
+        }
+        a = n;
+      }
+    }
+    // Hand over idle propagators
+    {
+      ActorLink* a = pl.next();
+      while (a != &pl) {
+        ActorLink* n = a->next();
+        int g = pa->find(Propagator::cast(a));
+        if ((g >= 0) && (w[g] >= 0)) {
+          a->unlink(); sh[w[g]]->pl.head(a);
+        }
+        a = n;
+      }
+    }
+    // Hand over propagators that must be disposed
+    {
+      Actor** d = d_fst;
+      while (d < d_cur) {
+        int g = pa->find(*d);
+        if ((g >= 0) && (w[g] >= 0)) {
+          sh[w[g]]->notice(**d,AP_DISPOSE);
+          *d = *(--d_cur);
+        } else {
+          d++;
+        }
+      }
+    }
+
+    // Propagate, the first shadow space is propagated by this thread
+    for (unsigned int i=1; i<n_w; i++)
+      Support::Thread::run(new Shadow::Worker(*sh[i]));
+    sh[0]->propagate();
+    e.wait();
+
+    // Take back propagators and memory
+    bool f = false;
+    for (unsigned int i=0; i<n_w; i++) {
+      Shadow& t = *sh[i];
+      stat.propagate += t.stat.propagate;
+      if (t.ss == SS_FAILED)
+        f = true;
+      // Propagators remain scheduled if propagation has failed
+      for (int c=0; c<=PropCost::AC_MAX; c++) {
+        ActorLink* q = &t.pc.p.queue[c];
+        while (!q->empty()) {
+          ActorLink* a = q->next();
+          a->unlink(); pc.p.queue[c].tail(a);
+        }
+      }
+      while (!t.pl.empty()) {
+        ActorLink* a = t.pl.next();
+        a->unlink(); pl.head(a);
+      }
+      for (Actor** d = t.d_fst; d < t.d_cur; d++)
+        notice(**d,AP_DISPOSE);
+      t.d_fst = t.d_cur = t.d_lst = NULL;
+      for (Propagator** p = t.f_fst; p < t.f_cur; p++)
+        notice(**p,AP_FAILURE);
+      t.f_fst = t.f_cur = t.f_lst = NULL;
+      if (t.n_wmp > 0)
+        n_wmp = std::max(n_wmp,1U) + t.n_wmp - 1;
+      pc.p.n_sub += t.pc.p.n_sub;
+      pa->unite(*t.pa);
+      mm.merge(t.mm);
+      delete sh[i];
+    }
+
+    // Find highest queue that contains a propagator
+    pc.p.active = &pc.p.queue[PropCost::AC_MAX];
+    while ((pc.p.active >= &pc.p.queue[0]) && pc.p.active->empty())
+      pc.p.active--;
+    if (f)
+      fail();
+#else
+    (void) stat;
+#endif
+  }
+
+}
+
+// STATISTICS: kernel-core
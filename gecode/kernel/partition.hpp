@@ -0,0 +1,152 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  class Actor;
+
+  /**
+   * \brief Partition of propagators into groups with disjoint variables
+   *
+   * Two propagators belong to the same group if they are subscribed
+   * to the same variable (directly or by an advisor), or if they
+   * belong to the same group as a third propagator. Hence, executing
+   * a propagator only schedules propagators of its own group, and
+   * groups can be propagated independently of each other (see
+   * Space::parallel).
+   *
+   * Groups are only ever merged: when subscriptions are cancelled,
+   * groups that have become independent are only separated when the
+   * partition is recomputed during cloning.
+   *
+   * \ingroup FuncMemSpace
+   */
+  class PropPartition {
+  private:
+    /// Entry of hash table mapping propagators to groups
+    class Entry {
+    public:
+      /// The propagator (NULL if entry is unused)
+      const Actor* a;
+      /// The group
+      unsigned int g;
+    };
+    /// The hash table
+    Entry* t;
+    /// Size of the hash table minus one (size is a power of two)
+    unsigned int mask;
+    /// Number of used entries in hash table
+    unsigned int n_e;
+    /// Parent of a group (union-find)
+    unsigned int* up;
+    /// Number of groups
+    unsigned int n_g;
+    /// Size of parent array
+    unsigned int s_g;
+    /// Number of threads
+    unsigned int n_t;
+    /// Whether all propagators are known
+    bool c;
+    /// Return hash table entry for \a a
+    Entry& entry(const Actor* a) const;
+    /// Return group for \a a (create if not known)
+    unsigned int group(const Actor* a);
+    /// Return representative of group \a g
+    unsigned int root(unsigned int g);
+    /// Resize hash table
+    void resize(void);
+  public:
+    /**
+     * \brief Minimal number of scheduled propagators
+     *
+     * Propagation is only performed in parallel if at least this many
+     * propagators are scheduled.
+     */
+    static const unsigned int n_min = 512;
+    /// Initialize for \a n threads, where \a c tells whether all propagators are known
+    GECODE_KERNEL_EXPORT PropPartition(unsigned int n, bool c);
+    /// Delete partition
+    GECODE_KERNEL_EXPORT ~PropPartition(void);
+    /// Return number of threads
+    unsigned int threads(void) const;
+    /// Set number of threads to \a n
+    void threads(unsigned int n);
+    /// Return whether all propagators of the space are known
+    bool complete(void) const;
+    /// Put propagators \a a and \a b into the same group
+    GECODE_KERNEL_EXPORT void unite(const Actor* a, const Actor* b);
+    /// Put all propagators into the same group that are grouped by \a p
+    GECODE_KERNEL_EXPORT void unite(PropPartition& p);
+    /// Return group of propagator \a a (-1 if not known)
+    GECODE_KERNEL_EXPORT int find(const Actor* a);
+    /// Return upper bound for number of groups
+    unsigned int groups(void) const;
+    /// Allocate memory from heap
+    static void* operator new(size_t s);
+    /// Free memory allocated from heap
+    static void  operator delete(void* p);
+  };
+
+
+  forceinline unsigned int
+  PropPartition::threads(void) const {
+    return n_t;
+  }
+  forceinline void
+  PropPartition::threads(unsigned int n) {
+    n_t = n;
+  }
+  forceinline bool
+  PropPartition::complete(void) const {
+    return c;
+  }
+  forceinline unsigned int
+  PropPartition::groups(void) const {
+    return n_g;
+  }
+  forceinline void*
+  PropPartition::operator new(size_t s) {
+    return Gecode::heap.ralloc(s);
+  }
+  forceinline void
+  PropPartition::operator delete(void* p) {
+    Gecode::heap.rfree(p);
+  }
+
+}
+
+// STATISTICS: kernel-core
@@ -0,0 +1,347 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode {
+
+  /**
+   * \brief Class for phase information
+   *
+   * For each variable, the value it takes in the last solution found
+   * and the value it had when propagation failed last are maintained.
+   * Value selection based on phases prefers the value from the last
+   * solution and otherwise the value from the last failure. This
+   * guides branch-and-bound search towards the neighborhood of the
+   * best solution found so far.
+   *
+   */
+  class Phase {
+  protected:
+    template<class View>
+    class Recorder;
+    /// Object for storing phase information
+    class Storage {
+    public:
+      /// Mutex to synchronize globally shared access
+      Support::Mutex m;
+      /// How many references exist for this object
+      unsigned int use_cnt;
+      /// Number of variables
+      int n;
+      /// Values from last solution
+      double* s;
+      /// Values from last failure
+      double* f;
+      /// Whether value from last solution is known
+      bool* hs;
+      /// Whether value from last failure is known
+      bool* hf;
+      /// Allocate for \a n0 variables
+      Storage(int n0);
+      /// Delete object
+      ~Storage(void);
+      /// Allocate memory from heap
+      static void* operator new(size_t s);
+      /// Free memory allocated from heap
+      static void  operator delete(void* p);
+    };
+
+    /// Pointer to storage object
+    Storage* storage;
+    /// Acquire mutex
+    void acquire(void);
+    /// Release mutex
+    void release(void);
+    /**
+     * \brief Initialize for \a n views
+     *
+     * This member function can only be used once and only if the
+     * phase storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_KERNEL_EXPORT
+    void init(int n);
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized phase storage is init and the assignment operator.
+     *
+     */
+    Phase(void);
+    /// Copy constructor
+    GECODE_KERNEL_EXPORT
+    Phase(const Phase& a);
+    /// Assignment operator
+    GECODE_KERNEL_EXPORT
+    Phase& operator =(const Phase& a);
+    /// Initialize for views \a x
+    template<class View>
+    Phase(Home home, ViewArray<View>& x);
+    /// Initialize for views \a x
+    template<class View>
+    void init(Home home, ViewArray<View>& x);
+    /// Test whether already initialized
+    bool initialized(void) const;
+    /// Default (empty) phase information
+    GECODE_KERNEL_EXPORT static const Phase def;
+    //@}
+
+    /// \name Update and delete phase information
+    //@{
+    /// Updating during cloning
+    GECODE_KERNEL_EXPORT
+    void update(Space& home, bool share, Phase& a);
+    /// Record values (medians) of views \a x as solution
+    template<class View>
+    void solution(const ViewArray<View>& x);
+    /// Destructor
+    GECODE_KERNEL_EXPORT
+    ~Phase(void);
+    //@}
+    
+    /// \name Information access
+    //@{
+    /**
+     * \brief Return whether a phase for the view at position \a i is known
+     *
+     * If a phase is known, it is stored in \a v. The value from
+     * the last solution takes precedence over the value from the
+     * last failure.
+     *
+     */
+    bool phase(int i, double& v) const;
+    /// Return number of views
+    int size(void) const;
+    //@}
+  };
+
+  /// Propagator for recording values at failure
+  template<class View>
+  class Phase::Recorder : public NaryPropagator<View,PC_GEN_NONE> {
+  protected:
+    using NaryPropagator<View,PC_GEN_NONE>::x;
+    /// Access to phase information
+    Phase phase;
+    /// Constructor for cloning \a p
+    Recorder(Space& home, bool share, Recorder<View>& p);
+  public:
+    /// Constructor for creation
+    Recorder(Home home, ViewArray<View>& x, Phase& phase);
+    /// Copy propagator during cloning
+    virtual Propagator* copy(Space& home, bool share);
+    /// Perform propagation (never executed as no subscriptions exist)
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Record values of assigned views at failure
+    virtual void failed(Space& home, const Propagator& p);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post phase recorder propagator
+    static ExecStatus post(Home home, ViewArray<View>& x, Phase& phase);
+  };
+
+
+  /*
+   * Posting of phase recorder propagator
+   *
+   */
+  template<class View>
+  forceinline
+  Phase::Recorder<View>::Recorder(Home home, ViewArray<View>& x, 
+                                  Phase& phase0)
+    : NaryPropagator<View,PC_GEN_NONE>(home,x), phase(phase0) {
+    home.notice(*this,AP_DISPOSE);
+    home.notice(*this,AP_FAILURE);
+  }
+
+  template<class View>
+  forceinline ExecStatus
+  Phase::Recorder<View>::post(Home home, ViewArray<View>& x, Phase& phase) {
+    (void) new (home) Recorder<View>(home,x,phase);
+    return ES_OK;
+  }
+
+
+  /*
+   * Phase storage
+   *
+   */
+  forceinline void*
+  Phase::Storage::operator new(size_t s) {
+    return Gecode::heap.ralloc(s);
+  }
+  forceinline void
+  Phase::Storage::operator delete(void* p) {
+    Gecode::heap.rfree(p);
+  }
+  forceinline
+  Phase::Storage::Storage(int n0)
+    : use_cnt(1), n(n0), 
+      s(heap.alloc<double>(n0)), f(heap.alloc<double>(n0)),
+      hs(heap.alloc<bool>(n0)), hf(heap.alloc<bool>(n0)) {
+    for (int i=n; i--; ) {
+      s[i] = f[i] = 0.0; hs[i] = hf[i] = false;
+    }
+  }
+  forceinline
+  Phase::Storage::~Storage(void) {
+    heap.free<double>(s,n);
+    heap.free<double>(f,n);
+    heap.free<bool>(hs,n);
+    heap.free<bool>(hf,n);
+  }
+
+
+  /*
+   * Phases
+   *
+   */
+
+  forceinline bool
+  Phase::phase(int i, double& v) const {
+    assert(storage != NULL);
+    assert((i >= 0) && (i < storage->n));
+    if (storage->hs[i]) {
+      v = storage->s[i]; return true;
+    } else if (storage->hf[i]) {
+      v = storage->f[i]; return true;
+    }
+    return false;
+  }
+  forceinline int
+  Phase::size(void) const {
+    return storage->n;
+  }
+  forceinline void
+  Phase::acquire(void) {
+    storage->m.acquire();
+  }
+  forceinline void
+  Phase::release(void) {
+    storage->m.release();
+  }
+
+
+  forceinline
+  Phase::Phase(void) : storage(NULL) {}
+
+  forceinline bool
+  Phase::initialized(void) const {
+    return storage != NULL;
+  }
+
+  template<class View>
+  forceinline
+  Phase::Phase(Home home, ViewArray<View>& x) : storage(NULL) {
+    init(home,x);
+  }
+  template<class View>
+  forceinline void
+  Phase::init(Home home, ViewArray<View>& x) {
+    init(x.size());
+    (void) Recorder<View>::post(home,x,*this);
+  }
+
+  template<class View>
+  forceinline void
+  Phase::solution(const ViewArray<View>& x) {
+    assert(storage != NULL);
+    assert(x.size() == storage->n);
+    acquire();
+    for (int i=x.size(); i--; ) {
+      storage->s[i] = static_cast<double>(x[i].med());
+      storage->hs[i] = true;
+    }
+    release();
+  }
+
+
+  /*
+   * Recording of phases
+   *
+   */
+  template<class View>
+  forceinline
+  Phase::Recorder<View>::Recorder(Space& home, bool share,
+                                  Recorder<View>& p) 
+    : NaryPropagator<View,PC_GEN_NONE>(home,share,p) {
+    phase.update(home, share, p.phase);
+  }
+
+  template<class View>
+  Propagator*
+  Phase::Recorder<View>::copy(Space& home, bool share) {
+    return new (home) Recorder<View>(home, share, *this);
+  }
+
+  template<class View>
+  inline size_t
+  Phase::Recorder<View>::dispose(Space& home) {
+    // Delete access to phase information
+    home.ignore(*this,AP_DISPOSE);
+    home.ignore(*this,AP_FAILURE);
+    phase.~Phase();
+    (void) NaryPropagator<View,PC_GEN_NONE>::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View>
+  ExecStatus
+  Phase::Recorder<View>::propagate(Space&, const ModEventDelta&) {
+    GECODE_NEVER;
+    return ES_FIX;
+  }
+
+  template<class View>
+  void
+  Phase::Recorder<View>::failed(Space&, const Propagator&) {
+    // Lock phase information
+    phase.acquire();
+    for (int i=x.size(); i--; )
+      if (x[i].assigned()) {
+        phase.storage->f[i] = static_cast<double>(x[i].med());
+        phase.storage->hf[i] = true;
+      }
+    phase.release();
+  }
+  
+}
+
+// STATISTICS: kernel-branch
@@ -0,0 +1,148 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+
+namespace Gecode {
+
+  /*
+   * Signature tables
+   *
+   */
+  bool
+  SignatureTable::find(const Signature& s) const {
+    if (b == NULL)
+      return false;
+    size_t h = s.hash();
+    for (Entry* e = b[h & mask]; e != NULL; e = e->next)
+      if ((e->h == h) && (e->n == s.d.entries()) &&
+          (strcmp(e->k,s.k) == 0)) {
+        int i = 0;
+        while ((i < e->n) && (e->d[i] == s.d[i]))
+          i++;
+        if (i == e->n)
+          return true;
+      }
+    return false;
+  }
+
+  void
+  SignatureTable::resize(void) {
+    size_t m = (b == NULL) ? 63 : 2*mask+1;
+    Entry** nb = heap.alloc<Entry*>(m+1);
+    for (size_t i=0; i<=m; i++)
+      nb[i] = NULL;
+    if (b != NULL) {
+      for (size_t i=0; i<=mask; i++) {
+        Entry* e = b[i];
+        while (e != NULL) {
+          Entry* f = e->next;
+          e->next = nb[e->h & m]; nb[e->h & m] = e;
+          e = f;
+        }
+      }
+      heap.free<Entry*>(b,mask+1);
+    }
+    b = nb; mask = m;
+  }
+
+  void
+  SignatureTable::add(const Signature& s) {
+    if ((b == NULL) || (n > mask))
+      resize();
+    int m = s.d.entries();
+    Entry* e = static_cast<Entry*>
+      (heap.ralloc(sizeof(Entry) + ((m > 0) ? m-1 : 0)*sizeof(size_t)));
+    e->h = s.hash();
+    e->k = s.k;
+    e->n = m;
+    for (int i=m; i--; )
+      e->d[i] = s.d[i];
+    e->next = b[e->h & mask]; b[e->h & mask] = e;
+    n++;
+  }
+
+  SignatureTable::~SignatureTable(void) {
+    if (b != NULL) {
+      for (size_t i=0; i<=mask; i++) {
+        Entry* e = b[i];
+        while (e != NULL) {
+          Entry* f = e->next;
+          heap.rfree(e);
+          e = f;
+        }
+      }
+      heap.free<Entry*>(b,mask+1);
+    }
+  }
+
+
+  /*
+   * Identical propagators for spaces
+   *
+   */
+  void
+  Space::identical(bool b) {
+    if (b && (sig == NULL)) {
+      sig = new SignatureTable;
+    } else if (!b && (sig != NULL)) {
+      delete sig;
+      sig = NULL;
+    }
+  }
+
+  bool
+  Space::identical(const Signature& s) {
+    if (sig == NULL)
+      return false;
+    if (sig->find(s)) {
+      sig->removed++;
+      return true;
+    }
+    sig->add(s);
+    return false;
+  }
+
+  void
+  Space::implied(const Signature& s) {
+    if ((sig != NULL) && !sig->find(s))
+      sig->add(s);
+  }
+
+}
+
+// STATISTICS: kernel-core
@@ -0,0 +1,203 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  /**
+   * \brief Signature of a propagator for detecting identical propagators
+   *
+   * A signature describes a propagator by its kind and a sequence of
+   * data items (typically the variable implementations of its views
+   * and integer parameters). The kind is a string that must uniquely
+   * identify the propagator class including its template arguments
+   * (for example, \c "Int::Rel::Lq<IntView>"). Two propagators with
+   * the same signature must propagate the same constraint.
+   *
+   * Signatures are used by post functions to ask a space whether an
+   * identical propagator has already been posted (see
+   * Space::identical). The memory for the data items is allocated
+   * from a region.
+   *
+   * \ingroup TaskActor
+   */
+  class Signature {
+    friend class SignatureTable;
+  private:
+    /// The kind of the propagator
+    const char* k;
+    /// The data items
+    Support::DynamicStack<size_t,Region> d;
+  public:
+    /// Initialize signature for propagator kind \a k with region \a r
+    Signature(Region& r, const char* k);
+    /// \name Adding data items
+    //@{
+    /// Add integer \a i
+    Signature& operator <<(int i);
+    /// Add variable implementation \a x
+    Signature& operator <<(const VarImpBase* x);
+    /// Sort data items starting at position \a i (for commutative data)
+    void sort(int i=0);
+    //@}
+    /// Return hash value
+    size_t hash(void) const;
+  };
+
+  /**
+   * \brief Table of signatures of posted propagators
+   *
+   * The table is kept by a space that detects identical propagators.
+   * It is not copied when the space is cloned.
+   *
+   */
+  class SignatureTable {
+  private:
+    /// Entry for a signature
+    class Entry {
+    public:
+      /// Next entry in the same bucket
+      Entry* next;
+      /// Hash value
+      size_t h;
+      /// Kind of propagator
+      const char* k;
+      /// Number of data items
+      int n;
+      /// Data items (allocated with the entry)
+      size_t d[1];
+    };
+    /// The buckets
+    Entry** b;
+    /// Number of buckets minus one (number of buckets is a power of two)
+    size_t mask;
+    /// Number of entries
+    size_t n;
+    /// Resize table
+    void resize(void);
+  public:
+    /// Number of propagators that have not been posted
+    unsigned long int removed;
+    /// Initialize empty table with \a r removed propagators
+    SignatureTable(unsigned long int r=0UL);
+    /// Test whether signature \a s is in the table
+    GECODE_KERNEL_EXPORT bool find(const Signature& s) const;
+    /// Add signature \a s to table
+    GECODE_KERNEL_EXPORT void add(const Signature& s);
+    /// Delete table
+    GECODE_KERNEL_EXPORT ~SignatureTable(void);
+    /// Allocate memory from heap
+    static void* operator new(size_t s);
+    /// Free memory allocated from heap
+    static void  operator delete(void* p);
+  };
+
+
+  /*
+   * Signatures
+   *
+   */
+  forceinline
+  Signature::Signature(Region& r, const char* k0)
+    : k(k0), d(r,8) {}
+  forceinline Signature&
+  Signature::operator <<(int i) {
+    d.push(static_cast<size_t>(i));
+    return *this;
+  }
+  forceinline Signature&
+  Signature::operator <<(const VarImpBase* x) {
+    d.push(reinterpret_cast<size_t>(x));
+    return *this;
+  }
+  forceinline void
+  Signature::sort(int i) {
+    if (d.entries()-i > 1)
+      Support::quicksort(&d[i],d.entries()-i);
+  }
+  forceinline size_t
+  Signature::hash(void) const {
+    size_t h = 0;
+    for (const char* c = k; *c != 0; c++)
+      h = 31*h + static_cast<size_t>(*c);
+    for (int i=0; i<d.entries(); i++)
+      h = 31*h + (d[i] ^ (d[i] >> 7));
+    return h;
+  }
+
+
+  /*
+   * Signature tables
+   *
+   */
+  forceinline
+  SignatureTable::SignatureTable(unsigned long int r)
+    : b(NULL), mask(0), n(0), removed(r) {}
+  forceinline void*
+  SignatureTable::operator new(size_t s) {
+    return Gecode::heap.ralloc(s);
+  }
+  forceinline void
+  SignatureTable::operator delete(void* p) {
+    Gecode::heap.rfree(p);
+  }
+
+
+  /*
+   * Identical propagators for spaces
+   *
+   */
+  forceinline bool
+  Space::identical(void) const {
+    return sig != NULL;
+  }
+  forceinline unsigned long int
+  Space::identical_removed(void) const {
+    return (sig != NULL) ? sig->removed : 0UL;
+  }
+
+  forceinline bool
+  Home::identical(const Signature& sg) {
+    return s.identical(sg);
+  }
+  forceinline void
+  Home::implied(const Signature& sg) {
+    s.implied(sg);
+  }
+
+}
+
+// STATISTICS: kernel-core
@@ -0,0 +1,317 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+
+#ifdef GECODE_HAS_UNISTD_H
+#include <unistd.h>
+#include <signal.h>
+#include <sys/mman.h>
+#if defined(MAP_ANONYMOUS) && defined(SA_SIGINFO)
+#define GECODE_TRAIL_PROTECT
+#endif
+#endif
+
+namespace Gecode {
+
+  /// Mutex for the list of all trails
+  static Support::Mutex trail_m;
+  /// List of all trails
+  static Trail* trails = NULL;
+  /// Size of a page (only used if pages can be protected)
+  static size_t trail_ps = 0;
+
+#ifdef GECODE_TRAIL_PROTECT
+
+  /// Whether the signal handlers have been installed
+  static bool trail_installed = false;
+  /// Previous action for segmentation faults
+  static struct sigaction trail_segv;
+  /// Previous action for bus errors
+  static struct sigaction trail_bus;
+
+  /// Handle writes to write-protected pages
+  static void
+  trail_handler(int sig, siginfo_t* si, void* ctx) {
+    if (Trail::handle(si->si_addr))
+      return;
+    // Pass on to the previous action
+    struct sigaction* sa = (sig == SIGSEGV) ? &trail_segv : &trail_bus;
+    if (sa->sa_flags & SA_SIGINFO) {
+      sa->sa_sigaction(sig,si,ctx);
+    } else if ((sa->sa_handler == SIG_DFL) || (sa->sa_handler == SIG_IGN)) {
+      // The fault occurs again with the default action
+      struct sigaction dfl;
+      dfl.sa_handler = SIG_DFL;
+      sigemptyset(&dfl.sa_mask);
+      dfl.sa_flags = 0;
+      (void) sigaction(sig,&dfl,NULL);
+    } else {
+      sa->sa_handler(sig);
+    }
+  }
+
+  /// Install signal handlers
+  static void
+  trail_install(void) {
+    if (trail_installed)
+      return;
+    trail_ps = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    struct sigaction sa;
+    sa.sa_sigaction = &trail_handler;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_SIGINFO;
+    (void) sigaction(SIGSEGV,&sa,&trail_segv);
+#ifdef SIGBUS
+    (void) sigaction(SIGBUS,&sa,&trail_bus);
+#endif
+    trail_installed = true;
+  }
+
+  /// Make \a s bytes at \a p read-only or writable (if \a w)
+  forceinline bool
+  trail_protect(char* p, size_t s, bool w) {
+    return ::mprotect(p, s, w ? (PROT_READ | PROT_WRITE) : PROT_READ) == 0;
+  }
+
+#else
+
+  forceinline void
+  trail_install(void) {}
+
+  forceinline bool
+  trail_protect(char*, size_t, bool) {
+    return false;
+  }
+
+#endif
+
+
+  /*
+   * Trail
+   *
+   */
+  Trail::Trail(Space& h)
+    : home(h), save(heap), chunk(heap), level(heap), dirty(heap),
+      known(NULL), mem(0), rev(true), prev(NULL) {
+    Support::Lock l(trail_m);
+    trail_install();
+    next = trails;
+    if (trails != NULL)
+      trails->prev = this;
+    trails = this;
+  }
+
+  Trail::~Trail(void) {
+    Support::Lock l(trail_m);
+    if (prev != NULL)
+      prev->next = next;
+    else
+      trails = next;
+    if (next != NULL)
+      next->prev = prev;
+    // Make all memory chunks writable again
+    for (int i=chunk.entries(); i--; )
+      if (chunk[i].prot)
+        (void) trail_protect(chunk[i].addr,chunk[i].size,true);
+    while (!save.empty()) {
+      Save s = save.pop();
+      heap.rfree(s.copy);
+    }
+    while (!level.empty())
+      heap.rfree(level.pop().space);
+  }
+
+  bool
+  Trail::handle(void* a) {
+    Support::Lock l(trail_m);
+    for (Trail* t = trails; t != NULL; t = t->next)
+      if (t->fault(a))
+        return true;
+    return false;
+  }
+
+  bool
+  Trail::fault(void* a) {
+    char* p = static_cast<char*>(a);
+    for (int i=chunk.entries(); i--; ) {
+      const Chunk& c = chunk[i];
+      if (c.prot && (c.addr <= p) && (p < c.addr+c.size)) {
+        Save s;
+        s.addr = c.addr + ((p - c.addr) / trail_ps) * trail_ps;
+        s.size = trail_ps;
+        s.copy = static_cast<char*>(heap.ralloc(trail_ps));
+        s.chunk = i;
+        memcpy(s.copy, s.addr, trail_ps);
+        save.push(s); mem += trail_ps;
+        (void) trail_protect(s.addr,trail_ps,true);
+        dirty.push(s.addr);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  unsigned int
+  Trail::mark(void) {
+    Support::Lock m(trail_m);
+    // Protect pages that have been written since the last mark
+    while (!dirty.empty())
+      (void) trail_protect(dirty.pop(),trail_ps,false);
+    // Add memory chunks allocated since the last mark
+    HeapChunk* fst = home.mm.cur_hc;
+    int n = chunk.entries();
+    if (n == 0)
+      add(fst);
+    for (HeapChunk* hc = static_cast<HeapChunk*>(fst->next); hc != known;
+         hc = static_cast<HeapChunk*>(hc->next))
+      add(hc);
+    known = static_cast<HeapChunk*>(fst->next);
+    Level l;
+    l.n_save = save.entries();
+    l.n_chunk = chunk.entries();
+    l.hc = known;
+    // Save all memory chunks that are not protected
+    for (int i=0; i<chunk.entries(); i++)
+      if (!chunk[i].prot) {
+        Save s;
+        s.addr = chunk[i].addr;
+        s.size = chunk[i].size;
+        s.copy = static_cast<char*>(heap.ralloc(s.size));
+        s.chunk = i;
+        memcpy(s.copy, s.addr, s.size);
+        save.push(s); mem += s.size;
+      }
+    // Save the space object itself
+    l.space = static_cast<char*>(heap.ralloc(sizeof(Space)));
+    memcpy(l.space, &home, sizeof(Space));
+    mem += sizeof(Space);
+    level.push(l);
+    return static_cast<unsigned int>(level.entries()-1);
+  }
+
+  void
+  Trail::add(HeapChunk* hc) {
+    Chunk c;
+    c.addr = Support::ptr_cast<char*>(hc);
+    c.size = hc->size;
+    c.prot = false;
+    if (hc->mapped && (trail_ps > 0)) {
+      size_t s = ((c.size + trail_ps - 1) / trail_ps) * trail_ps;
+      if (trail_protect(c.addr,s,false)) {
+        c.size = s; c.prot = true;
+      }
+    }
+    chunk.push(c);
+  }
+
+  bool
+  Trail::undo(unsigned int l) {
+    if (!rev)
+      return false;
+    {
+      Support::Lock m(trail_m);
+      Level lv = level[static_cast<int>(l)];
+      // Make memory chunks allocated since the mark writable
+      for (int i=lv.n_chunk; i<chunk.entries(); i++)
+        if (chunk[i].prot)
+          (void) trail_protect(chunk[i].addr,chunk[i].size,true);
+      // Heap chunks allocated since the mark (before restoring the headers)
+      HeapChunk* hc = static_cast<HeapChunk*>(home.mm.cur_hc->next);
+      // All pages that are written are saved again
+      while (!dirty.empty())
+        (void) dirty.pop();
+      // Restore saved memory areas, older copies are restored later
+      while (save.entries() > lv.n_save) {
+        Save s = save.pop();
+        if (s.chunk < lv.n_chunk) {
+          if (chunk[s.chunk].prot) {
+            (void) trail_protect(s.addr,s.size,true);
+            dirty.push(s.addr);
+          }
+          memcpy(s.addr, s.copy, s.size);
+        }
+        heap.rfree(s.copy); mem -= s.size;
+      }
+      while (chunk.entries() > lv.n_chunk)
+        (void) chunk.pop();
+      // Release heap chunks allocated since the mark
+      while (hc != lv.hc) {
+        HeapChunk* t = hc; hc = static_cast<HeapChunk*>(hc->next);
+        home.sm->heap_free(t);
+      }
+      known = lv.hc;
+      // Restore space object
+      memcpy(static_cast<void*>(&home), lv.space, sizeof(Space));
+      // Remove the mark and all later marks
+      while (level.entries() > static_cast<int>(l)) {
+        heap.rfree(level.pop().space);
+        mem -= sizeof(Space);
+      }
+    }
+    // Mark again so that further changes can be undone
+    (void) mark();
+    return true;
+  }
+
+
+  /*
+   * Trailing for spaces
+   *
+   */
+  unsigned int
+  Space::trail_mark(void) {
+    assert(!failed());
+    if (tr == NULL)
+      tr = new Trail(*this);
+    return tr->mark();
+  }
+
+  bool
+  Space::trail_undo(unsigned int l) {
+    return (tr != NULL) && (l < tr->marks()) && tr->undo(l);
+  }
+
+  void
+  Space::trail_release(void) {
+    delete tr;
+    tr = NULL;
+  }
+
+}
+
+// STATISTICS: kernel-core
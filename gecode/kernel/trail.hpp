@@ -0,0 +1,184 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  class Space;
+
+  /**
+   * \brief Trail for undoing changes to the memory of a space
+   *
+   * A trail records the state of a space when it is marked and can
+   * restore it later (see Space::trail_mark and Space::trail_undo).
+   * As all data structures of a space (variable implementations,
+   * propagators, advisors, branchers) are allocated from its memory
+   * chunks, the trail works on the memory chunks rather than on
+   * individual data structures:
+   *  - Memory chunks that have been mapped (see Heap::chunk_mode) are
+   *    write-protected when marking. The first write to a page after
+   *    a mark saves the page before the page becomes writable again.
+   *    Hence, only the pages that are actually modified are saved.
+   *  - All other memory chunks (or if write-protection is not supported
+   *    by the platform) are saved completely when marking.
+   *  - Memory chunks that are allocated after a mark are released when
+   *    undoing.
+   *
+   * Undoing is not possible if actors have been registered or
+   * deregistered for disposal after the oldest mark, as these actors
+   * might have released or acquired external resources.
+   *
+   * \ingroup FuncMemSpace
+   */
+  class Trail {
+    friend class Space;
+  private:
+    /// Memory area that has been saved
+    class Save {
+    public:
+      /// Start of memory area
+      char* addr;
+      /// Size of memory area
+      size_t size;
+      /// Copy of memory area
+      char* copy;
+      /// Index of memory chunk that contains the memory area
+      int chunk;
+    };
+    /// Memory chunk of the space
+    class Chunk {
+    public:
+      /// Start of memory chunk
+      char* addr;
+      /// Size of memory chunk
+      size_t size;
+      /// Whether the chunk is write-protected (otherwise saved by mark)
+      bool prot;
+    };
+    /// Information recorded by a mark
+    class Level {
+    public:
+      /// Number of saved memory areas
+      int n_save;
+      /// Number of memory chunks
+      int n_chunk;
+      /// Most recently allocated heap chunk
+      HeapChunk* hc;
+      /// Copy of the space object
+      char* space;
+    };
+    /// The space the trail is for
+    Space& home;
+    /// Saved memory areas
+    Support::DynamicStack<Save,Heap> save;
+    /// Memory chunks
+    Support::DynamicStack<Chunk,Heap> chunk;
+    /// Marks
+    Support::DynamicStack<Level,Heap> level;
+    /// Pages that have become writable since the last mark
+    Support::DynamicStack<char*,Heap> dirty;
+    /// Most recently allocated heap chunk that has been added
+    HeapChunk* known;
+    /// Size of saved memory
+    size_t mem;
+    /// Whether the changes can still be undone
+    bool rev;
+    /// Next trail in list of all trails
+    Trail* next;
+    /// Previous trail in list of all trails
+    Trail* prev;
+    /// Save page that contains address \a a, return whether page is known
+    bool fault(void* a);
+    /// Add heap chunk \a hc (write-protect if possible)
+    void add(HeapChunk* hc);
+    /// Initialize for space \a home
+    Trail(Space& home);
+    /// Delete trail and make all memory chunks writable
+    ~Trail(void);
+    /// Mark and return level of the mark
+    unsigned int mark(void);
+    /// Undo to mark \a l
+    bool undo(unsigned int l);
+  public:
+    /**
+     * \brief Handle write to write-protected page at address \a a
+     *
+     * Returns false if the page does not belong to any trail.
+     */
+    static bool handle(void* a);
+    /// Record that changes can no longer be undone
+    void irreversible(void);
+    /// Test whether changes can still be undone
+    bool reversible(void) const;
+    /// Return number of marks
+    unsigned int marks(void) const;
+    /// Return memory used by the trail
+    size_t size(void) const;
+    /// Allocate memory from heap
+    static void* operator new(size_t s);
+    /// Free memory allocated from heap
+    static void  operator delete(void* p);
+  };
+
+
+  forceinline void
+  Trail::irreversible(void) {
+    rev = false;
+  }
+  forceinline bool
+  Trail::reversible(void) const {
+    return rev;
+  }
+  forceinline unsigned int
+  Trail::marks(void) const {
+    return static_cast<unsigned int>(level.entries());
+  }
+  forceinline size_t
+  Trail::size(void) const {
+    return mem + save.size() + chunk.size() + level.size() + dirty.size();
+  }
+  forceinline void*
+  Trail::operator new(size_t s) {
+    return Gecode::heap.ralloc(s);
+  }
+  forceinline void
+  Trail::operator delete(void* p) {
+    Gecode::heap.rfree(p);
+  }
+
+}
+
+// STATISTICS: kernel-core
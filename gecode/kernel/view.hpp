@@ -54,6 +54,8 @@ namespace Gecode {
     unsigned int degree(void) const;
     /// Return accumulated failure count (plus degree)
     double afc(void) const;
+    /// Test whether propagator \a p depends on view
+    bool subscribed(const Propagator& p) const;
     /// Return whether this view is derived from a VarImpView
     static bool varderived(void);
     /// Return dummy variable implementation of view
@@ -138,6 +140,8 @@ namespace Gecode {
     unsigned int degree(void) const;
     /// Return accumulated failure count (plus degree)
     double afc(void) const;
+    /// Test whether propagator \a p depends on view
+    bool subscribed(const Propagator& p) const;
     //@}
 
     /// \name Domain tests
@@ -231,6 +235,8 @@ namespace Gecode {
     unsigned int degree(void) const;
     /// Return accumulated failure count (plus degree)
     double afc(void) const;
+    /// Test whether propagator \a p depends on view
+    bool subscribed(const Propagator& p) const;
     //@}
 
     /// \name Domain tests
@@ -353,6 +359,11 @@ namespace Gecode {
   }
   template<class View>
   forceinline bool
+  ConstView<View>::subscribed(const Propagator&) const {
+    return false;
+  }
+  template<class View>
+  forceinline bool
   ConstView<View>::varderived(void) {
     return false;
   }
@@ -445,6 +456,11 @@ namespace Gecode {
   }
   template<class Var>
   forceinline bool
+  VarImpView<Var>::subscribed(const Propagator& p) const {
+    return x->subscribed(p);
+  }
+  template<class Var>
+  forceinline bool
   VarImpView<Var>::assigned(void) const {
     return x->assigned();
   }
@@ -539,6 +555,11 @@ namespace Gecode {
   }
   template<class View>
   forceinline bool
+  DerivedView<View>::subscribed(const Propagator& p) const {
+    return x.subscribed(p);
+  }
+  template<class View>
+  forceinline bool
   DerivedView<View>::assigned(void) const {
     return x.assigned();
   }
@@ -0,0 +1,341 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  /**
+   * \brief Class for weighted degree (wdeg) information
+   *
+   * For each variable, a weight is maintained that is initialized
+   * with the variable's degree. Whenever propagation fails, the weight
+   * of each not yet assigned variable the failing propagator depends
+   * on is incremented. Hence, the weight reflects how often
+   * the constraints involving a variable have failed while the variable
+   * was still undecided.
+   *
+   */
+  class WDeg {
+  protected:
+    template<class View>
+    class Recorder;
+    /// Object for storing weights
+    class Storage {
+    public:
+      /// Mutex to synchronize globally shared access
+      Support::Mutex m;
+      /// How many references exist for this object
+      unsigned int use_cnt;
+      /// Weights
+      double* w;
+      /// Number of weights
+      int n;
+      /// Allocate for \a n0 weights
+      Storage(int n0);
+      /// Delete object
+      ~Storage(void);
+      /// Allocate memory from heap
+      static void* operator new(size_t s);
+      /// Free memory allocated from heap
+      static void  operator delete(void* p);
+    };
+
+    /// Pointer to storage object
+    Storage* storage;
+    /// Increment weight at position \a i
+    void bump(int i);
+    /// Acquire mutex
+    void acquire(void);
+    /// Release mutex
+    void release(void);
+    /**
+     * \brief Initialize for \a n views
+     *
+     * This member function can only be used once and only if the
+     * weight storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_KERNEL_EXPORT
+    void init(int n);
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized weight storage is init and the assignment operator.
+     *
+     */
+    WDeg(void);
+    /// Copy constructor
+    GECODE_KERNEL_EXPORT
+    WDeg(const WDeg& a);
+    /// Assignment operator
+    GECODE_KERNEL_EXPORT
+    WDeg& operator =(const WDeg& a);
+    /// Initialize for views \a x
+    template<class View>
+    WDeg(Home home, ViewArray<View>& x);
+    /// Initialize for views \a x
+    template<class View>
+    void init(Home home, ViewArray<View>& x);
+    /// Test whether already initialized
+    bool initialized(void) const;
+    /// Default (empty) weight information
+    GECODE_KERNEL_EXPORT static const WDeg def;
+    //@}
+
+    /// \name Update and delete weight information
+    //@{
+    /// Updating during cloning
+    GECODE_KERNEL_EXPORT
+    void update(Space& home, bool share, WDeg& a);
+    /// Destructor
+    GECODE_KERNEL_EXPORT
+    ~WDeg(void);
+    //@}
+    
+    /// \name Information access
+    //@{
+    /// Return weight at position \a i
+    double operator [](int i) const;
+    /// Return number of weights
+    int size(void) const;
+    //@}
+  };
+
+  /// Propagator for recording weights
+  template<class View>
+  class WDeg::Recorder : public NaryPropagator<View,PC_GEN_NONE> {
+  protected:
+    using NaryPropagator<View,PC_GEN_NONE>::x;
+    /// Access to weight information
+    WDeg wdeg;
+    /// Constructor for cloning \a p
+    Recorder(Space& home, bool share, Recorder<View>& p);
+  public:
+    /// Constructor for creation
+    Recorder(Home home, ViewArray<View>& x, WDeg& wdeg);
+    /// Copy propagator during cloning
+    virtual Propagator* copy(Space& home, bool share);
+    /// Perform propagation (never executed as no subscriptions exist)
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Record failure of propagator \a p
+    virtual void failed(Space& home, const Propagator& p);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post weight recorder propagator
+    static ExecStatus post(Home home, ViewArray<View>& x, WDeg& wdeg);
+  };
+    
+  /**
+   * \brief Print weights enclosed in curly brackets
+   * \relates WDeg
+   */
+  template<class Char, class Traits>
+  std::basic_ostream<Char,Traits>&
+  operator <<(std::basic_ostream<Char,Traits>& os,
+             const WDeg& wdeg);
+
+
+  /*
+   * Posting of weight recorder propagator
+   *
+   */
+  template<class View>
+  forceinline
+  WDeg::Recorder<View>::Recorder(Home home, ViewArray<View>& x, 
+                                 WDeg& wdeg0)
+    : NaryPropagator<View,PC_GEN_NONE>(home,x), wdeg(wdeg0) {
+    home.notice(*this,AP_DISPOSE);
+    home.notice(*this,AP_FAILURE);
+  }
+
+  template<class View>
+  forceinline ExecStatus
+  WDeg::Recorder<View>::post(Home home, ViewArray<View>& x, WDeg& wdeg) {
+    (void) new (home) Recorder<View>(home,x,wdeg);
+    return ES_OK;
+  }
+
+
+  /*
+   * Weight storage
+   *
+   */
+  forceinline void*
+  WDeg::Storage::operator new(size_t s) {
+    return Gecode::heap.ralloc(s);
+  }
+  forceinline void
+  WDeg::Storage::operator delete(void* p) {
+    Gecode::heap.rfree(p);
+  }
+  forceinline
+  WDeg::Storage::Storage(int n0)
+    : use_cnt(1), w(heap.alloc<double>(n0)), n(n0) {
+    for (int i=n; i--; )
+      w[i] = 1.0;
+  }
+  forceinline
+  WDeg::Storage::~Storage(void) {
+    heap.free<double>(w,n);
+  }
+
+
+  /*
+   * Weights
+   *
+   */
+
+  forceinline void
+  WDeg::bump(int i) {
+    assert(storage != NULL);
+    assert((i >= 0) && (i < storage->n));
+    storage->w[i] += 1.0;
+  }
+  forceinline double
+  WDeg::operator [](int i) const {
+    assert(storage != NULL);
+    assert((i >= 0) && (i < storage->n));
+    return storage->w[i];
+  }
+  forceinline int
+  WDeg::size(void) const {
+    return storage->n;
+  }
+  forceinline void
+  WDeg::acquire(void) {
+    storage->m.acquire();
+  }
+  forceinline void
+  WDeg::release(void) {
+    storage->m.release();
+  }
+
+
+  forceinline
+  WDeg::WDeg(void) : storage(NULL) {}
+
+  forceinline bool
+  WDeg::initialized(void) const {
+    return storage != NULL;
+  }
+
+  template<class View>
+  forceinline
+  WDeg::WDeg(Home home, ViewArray<View>& x) : storage(NULL) {
+    init(home,x);
+  }
+  template<class View>
+  forceinline void
+  WDeg::init(Home home, ViewArray<View>& x) {
+    init(x.size());
+    // Start from the degree of each variable
+    for (int i=x.size(); i--; )
+      if (x[i].degree() > 1)
+        storage->w[i] = static_cast<double>(x[i].degree());
+    (void) Recorder<View>::post(home,x,*this);
+  }
+
+  template<class Char, class Traits>
+  std::basic_ostream<Char,Traits>&
+  operator <<(std::basic_ostream<Char,Traits>& os,
+              const WDeg& wdeg) {
+    std::basic_ostringstream<Char,Traits> s;
+    s.copyfmt(os); s.width(0);
+    s << '{';
+    if (wdeg.size() > 0) {
+      s << wdeg[0];
+      for (int i=1; i<wdeg.size(); i++)
+        s << ", " << wdeg[i];
+    }
+    s << '}';
+    return os << s.str();
+  }
+  
+
+  /*
+   * Recording of weights
+   *
+   */
+  template<class View>
+  forceinline
+  WDeg::Recorder<View>::Recorder(Space& home, bool share,
+                                 Recorder<View>& p) 
+    : NaryPropagator<View,PC_GEN_NONE>(home,share,p) {
+    wdeg.update(home, share, p.wdeg);
+  }
+
+  template<class View>
+  Propagator*
+  WDeg::Recorder<View>::copy(Space& home, bool share) {
+    return new (home) Recorder<View>(home, share, *this);
+  }
+
+  template<class View>
+  inline size_t
+  WDeg::Recorder<View>::dispose(Space& home) {
+    // Delete access to weight information
+    home.ignore(*this,AP_DISPOSE);
+    home.ignore(*this,AP_FAILURE);
+    wdeg.~WDeg();
+    (void) NaryPropagator<View,PC_GEN_NONE>::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View>
+  ExecStatus
+  WDeg::Recorder<View>::propagate(Space&, const ModEventDelta&) {
+    GECODE_NEVER;
+    return ES_FIX;
+  }
+
+  template<class View>
+  void
+  WDeg::Recorder<View>::failed(Space&, const Propagator& p) {
+    // Lock weight information
+    wdeg.acquire();
+    for (int i=x.size(); i--; )
+      if (!x[i].assigned() && x[i].subscribed(p))
+        wdeg.bump(i);
+    wdeg.release();
+  }
+  
+}
+
+// STATISTICS: kernel-branch
@@ -102,7 +102,7 @@ namespace Gecode {
      * \brief %Search engine statistics
      * \ingroup TaskModelSearch
      */
-    class Statistics : public StatusStatistics {
+    class Statistics : public StatusStatistics, public CloneStatistics {
     public:
       /// Number of failed nodes in search tree
       unsigned long int fail;
@@ -171,8 +171,19 @@ namespace Gecode {
       unsigned int c_d;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
       unsigned int a_d;
+      /**
+       * \brief Whether sequential depth-first search uses trailing
+       *
+       * If true, backtracking undoes the changes to the current space
+       * (see Space::trail_mark) rather than recomputing from a clone.
+       * Clones are still created according to \a c_d and are used if
+       * changes can not be undone.
+       */
+      bool trail;
       /// Stop object for stopping search
       Stop* stop;
+      /// Runtime parameters for memory management (unchanged if NULL)
+      const MemoryOptions* memory;
       /// Default options
       GECODE_SEARCH_EXPORT static const Options def;
       /// Initialize with default values
@@ -447,11 +458,112 @@ namespace Gecode {
   template<class T>
   T* restart(T* s, const Search::Options& o=Search::Options::def);
 
+
+
+  /**
+   * \brief Limited discrepancy search engine
+   *
+   * The engine explores the search tree by a sequence of probes.
+   * Each probe is a depth-first search that does not take more
+   * than a certain number of discrepancies, where taking alternative
+   * \f$i\f$ of a choice counts as \f$i\f$ discrepancies. The first
+   * probe takes no discrepancies at all (it follows the heuristic)
+   * and each following probe allows one more discrepancy. Search
+   * ends as soon as a probe explores the entire search tree.
+   *
+   * Every solution is returned exactly once: a probe only returns
+   * solutions with as many discrepancies as its limit.
+   *
+   * This class supports limited discrepancy search for subclasses
+   * \a T of Space.
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  class LDS {
+  private:
+    /// The actual search engine
+    Search::Engine* e;
+  public:
+    /// Initialize search engine for space \a s with options \a o
+    LDS(T* s, const Search::Options& o=Search::Options::def);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    T* next(void);
+    /// Return statistics
+    Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    bool stopped(void) const;
+    /// Destructor
+    ~LDS(void);
+  };
+
+  /// Invoke limited discrepancy search engine for subclass \a T of space \a s with options \a o
+  template<class T>
+  T* lds(T* s, const Search::Options& o=Search::Options::def);
+
+
+
+  /**
+   * \brief Portfolio search engine
+   *
+   * The engine runs several assets in parallel, one asset per
+   * thread (as defined by the search options). Each asset
+   * performs sequential search on its own copy of the root space,
+   * where asset \f$i\f$ is configured by calling Space::asset
+   * with \f$i\f$. Hence, assets can use different branchings
+   * (for example, random variable or value selection with a
+   * different seed per asset).
+   *
+   * If \a best is false, assets perform depth-first search. The
+   * first asset to find a solution wins: all further solutions are
+   * found by that asset and all other assets are stopped.
+   *
+   * If \a best is true, assets perform branch-and-bound search. A
+   * solution found by some asset is only returned if it is better
+   * than all solutions found so far, and all other assets are
+   * constrained to find better solutions (see Space::constrain).
+   * The first asset that explores its entire search tree proves that
+   * the last solution returned is best and search is finished.
+   *
+   * This class supports portfolio search for subclasses \a T of
+   * Space.
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  class Portfolio {
+  private:
+    /// The actual search engine
+    Search::Engine* e;
+  public:
+    /// Initialize search engine for space \a s with options \a o
+    Portfolio(T* s, bool best,
+              const Search::Options& o=Search::Options::def);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    T* next(void);
+    /// Return statistics
+    Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    bool stopped(void) const;
+    /// Destructor
+    ~Portfolio(void);
+  };
+
+  /**
+   * \brief Invoke portfolio search engine for subclass \a T of space \a s with options \a o
+   *
+   * Returns the first solution if \a best is false and the best
+   * solution otherwise.
+   */
+  template<class T>
+  T* portfolio(T* s, bool best,
+               const Search::Options& o=Search::Options::def);
+
 }
 
 #include <gecode/search/dfs.hpp>
 #include <gecode/search/bab.hpp>
 #include <gecode/search/restart.hpp>
+#include <gecode/search/lds.hpp>
+#include <gecode/search/portfolio.hpp>
 
 #endif
 
@@ -46,6 +46,8 @@ namespace Gecode { namespace Search {
     
   Engine* 
   bab(Space* s, size_t sz, const Options& o) {
+    if (o.memory != NULL)
+      s->memory(*o.memory);
 #ifdef GECODE_HAS_THREADS
     Options to = o.expand();
     if (to.threads == 1.0)
@@ -37,6 +37,7 @@
 
 #include <gecode/search.hh>
 #include <gecode/search/sequential/dfs.hh>
+#include <gecode/search/sequential/trail-dfs.hh>
 #ifdef GECODE_HAS_THREADS
 #include <gecode/search/parallel/dfs.hh>
 #endif
@@ -46,13 +47,19 @@ namespace Gecode { namespace Search {
 
   Engine* 
   dfs(Space* s, size_t sz, const Options& o) {
+    if (o.memory != NULL)
+      s->memory(*o.memory);
 #ifdef GECODE_HAS_THREADS
     Options to = o.expand();
-    if (to.threads == 1.0)
+    if ((to.threads == 1.0) && to.trail)
+      return new WorkerToEngine<Sequential::TrailDFS>(s,sz,to);
+    else if (to.threads == 1.0)
       return new WorkerToEngine<Sequential::DFS>(s,sz,to);
     else
       return new Parallel::DFS(s,sz,to);
 #else
+    if (o.trail)
+      return new WorkerToEngine<Sequential::TrailDFS>(s,sz,o);
     return new WorkerToEngine<Sequential::DFS>(s,sz,o);
 #endif
   }
@@ -0,0 +1,64 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search.hh>
+#include <gecode/search/sequential/lds.hh>
+#ifdef GECODE_HAS_THREADS
+#include <gecode/search/parallel/lds.hh>
+#endif
+#include <gecode/search/support.hh>
+
+namespace Gecode { namespace Search {
+
+  Engine* 
+  lds(Space* s, size_t sz, const Options& o) {
+    if (o.memory != NULL)
+      s->memory(*o.memory);
+#ifdef GECODE_HAS_THREADS
+    Options to = o.expand();
+    if (to.threads == 1.0)
+      return new WorkerToEngine<Sequential::LDS>(s,sz,to);
+    else
+      return new Parallel::LDS(s,sz,to);
+#else
+    return new WorkerToEngine<Sequential::LDS>(s,sz,o);
+#endif
+  }
+
+}}
+
+// STATISTICS: search-other
@@ -41,8 +41,8 @@ namespace Gecode { namespace Search {
   Options::Options(void)
     : clone(Config::clone), 
       threads(Config::threads), 
-      c_d(Config::c_d), a_d(Config::a_d), 
-      stop(NULL) {}
+      c_d(Config::c_d), a_d(Config::a_d), trail(false),
+      stop(NULL), memory(NULL) {}
 
 }}
 
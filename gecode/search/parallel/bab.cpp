@@ -81,6 +81,9 @@ namespace Gecode { namespace Search { namespace Parallel {
         // Perform exploration work
         {
           m.acquire();
+          // Check for a better solution without locking the engine
+          if (!idle && (v != engine().incumbent()))
+            better();
           if (idle) {
             m.release();
             // Try to find new work
@@ -123,7 +126,7 @@ namespace Gecode { namespace Search { namespace Parallel {
                 {
                   Space* c;
                   if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                    c = cur->clone(true,*this);
                     d = 1;
                   } else {
                     c = NULL;
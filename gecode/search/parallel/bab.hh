@@ -52,6 +52,8 @@ namespace Gecode { namespace Search { namespace Parallel {
       int mark;
       /// Best solution found so far
       Space* best;
+      /// Version of best solution
+      unsigned long int v;
     public:
       /// Initialize for space \a s (of size \a sz) with engine \a e
       Worker(Space* s, size_t sz, BAB& e);
@@ -59,8 +61,8 @@ namespace Gecode { namespace Search { namespace Parallel {
       BAB& engine(void) const;
       /// Start execution of worker
       virtual void run(void);
-      /// Accept better solution \a b
-      void better(Space* b);
+      /// Accept better solution from engine
+      void better(void);
       /// Try to find some work
       void find(void);
       /// Destructor
@@ -70,9 +72,15 @@ namespace Gecode { namespace Search { namespace Parallel {
     Worker** _worker;
     /// Best solution so far
     Space* best;
+    /// Version of best solution (incremented for every better solution)
+    volatile unsigned long int version;
   public:
     /// Provide access to worker \a i
     Worker* worker(unsigned int i) const;
+    /// Return version of best solution
+    unsigned long int incumbent(void) const;
+    /// Return copy of best solution and set \a v to its version
+    Space* incumbent(unsigned long int& v);
 
     /// \name Search control
     //@{
@@ -104,6 +112,10 @@ namespace Gecode { namespace Search { namespace Parallel {
   BAB::worker(unsigned int i) const {
     return _worker[i];
   }
+  forceinline unsigned long int
+  BAB::incumbent(void) const {
+    return version;
+  }
 
 
   /*
@@ -111,11 +123,11 @@ namespace Gecode { namespace Search { namespace Parallel {
    */
   forceinline
   BAB::Worker::Worker(Space* s, size_t sz, BAB& e)
-    : Engine::Worker(s,sz,e), mark(0), best(NULL) {}
+    : Engine::Worker(s,sz,e), mark(0), best(NULL), v(0UL) {}
 
   forceinline
   BAB::BAB(Space* s, size_t sz, const Options& o)
-    : Engine(o), best(NULL) {
+    : Engine(o), best(NULL), version(0UL) {
     // Create workers
     _worker = static_cast<Worker**>
       (heap.ralloc(workers() * sizeof(Worker*)));
@@ -135,15 +147,28 @@ namespace Gecode { namespace Search { namespace Parallel {
   /*
    * Engine: search control
    */
+  forceinline Space*
+  BAB::incumbent(unsigned long int& v) {
+    m_search.acquire();
+    Space* b = best->clone(false);
+    v = version;
+    m_search.release();
+    return b;
+  }
   forceinline void
-  BAB::Worker::better(Space* b) {
-    m.acquire();
+  BAB::Worker::better(void) {
     delete best;
-    best = b->clone(false);
-    mark = path.entries();
-    if (cur != NULL)
+    best = engine().incumbent(v);
+    // Prune all nodes on the path that can not lead to better solutions
+    if (path.prune(*this,*best)) {
+      delete cur;
+      cur = NULL;
+      Worker::current(NULL);
+    } else if (cur != NULL) {
       cur->constrain(*best);
-    m.release();
+    }
+    // All nodes are now guaranteed to be better
+    mark = 0;
   }
   forceinline void 
   BAB::solution(Space* s) {
@@ -161,9 +186,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     } else {
       best = s->clone();
     }
-    // Announce better solutions
-    for (unsigned int i=0; i<workers(); i++)
-      worker(i)->better(best);
+    // Workers poll the version and pick up the better solution
+    version++;
     bool bs = signal();
     solutions.push(s);
     if (bs)
@@ -180,12 +204,14 @@ namespace Gecode { namespace Search { namespace Parallel {
     // Try to find new work (even if there is none)
     for (unsigned int i=0; i<engine().workers(); i++) {
       unsigned long int r_d = 0ul;
-      if (Space* s = engine().worker(i)->steal(r_d)) {
+      unsigned int r_n = 0U;
+      if (Space* s = engine().worker(i)->steal(r_d,r_n)) {
         // Reset this guy
         m.acquire();
         idle = false;
         d = 0;
         cur = s;
+        path.reset(r_n);
         mark = 0;
         if (best != NULL)
           cur->constrain(*best);
@@ -111,7 +111,13 @@ namespace Gecode { namespace Search { namespace Parallel {
                 m.release();
                 break;
               case SS_SOLVED:
-                {
+                if (path.repeated()) {
+                  // Solution has been found by a probe with smaller limit
+                  delete cur;
+                  cur = NULL;
+                  Worker::current(NULL);
+                  m.release();
+                } else {
                   // Deletes all pending branchers
                   (void) cur->choice();
                   Space* s = cur->clone(false);
@@ -126,7 +132,7 @@ namespace Gecode { namespace Search { namespace Parallel {
                 {
                   Space* c;
                   if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                    c = cur->clone(true,*this);
                     d = 1;
                   } else {
                     c = NULL;
@@ -58,6 +58,10 @@ namespace Gecode { namespace Search { namespace Parallel {
       void find(void);
       /// Reset engine to restart at space \a s and return new root space
       Space* reset(Space* s);
+      /// Set discrepancy limit to \a l
+      void limit(unsigned int l);
+      /// Test whether alternatives have not been explored due to the discrepancy limit
+      bool truncated(void) const;
     };
     /// Array of worker references
     Worker** _worker;
@@ -142,6 +146,14 @@ namespace Gecode { namespace Search { namespace Parallel {
       return s->clone(false);
     }
   }
+  forceinline void
+  DFS::Worker::limit(unsigned int l) {
+    path.limit(l);
+  }
+  forceinline bool
+  DFS::Worker::truncated(void) const {
+    return path.truncated();
+  }
   forceinline Space*
   DFS::reset(Space* s) {
     // All workers are marked as busy again
@@ -175,12 +187,14 @@ namespace Gecode { namespace Search { namespace Parallel {
     // Try to find new work (even if there is none)
     for (unsigned int i=0; i<engine().workers(); i++) {
       unsigned long int r_d = 0ul;
-      if (Space* s = engine().worker(i)->steal(r_d)) {
+      unsigned int r_n = 0U;
+      if (Space* s = engine().worker(i)->steal(r_d,r_n)) {
         // Reset this guy
         m.acquire();
         idle = false;
         d = 0;
         cur = s;
+        path.reset(r_n);
         Search::Worker::reset(cur,r_d);
         m.release();
         return;
@@ -66,8 +66,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     public:
       /// Initialize for space \a s (of size \a sz) with engine \a e
       Worker(Space* s, size_t sz, Engine& e);
-      /// Hand over some work (NULL if no work available)
-      Space* steal(unsigned long int& d);
+      /// Hand over some work with \a n discrepancies (NULL if no work available)
+      Space* steal(unsigned long int& d, unsigned int& n);
       /// Return statistics
       Statistics statistics(void);
       /// Provide access to engine
@@ -393,7 +393,7 @@ namespace Gecode { namespace Search { namespace Parallel {
    * Worker: finding and stealing working
    */
   forceinline Space*
-  Engine::Worker::steal(unsigned long int& d) {
+  Engine::Worker::steal(unsigned long int& d, unsigned int& n) {
     /*
      * Make a quick check whether the worker might have work
      *
@@ -403,7 +403,7 @@ namespace Gecode { namespace Search { namespace Parallel {
     if (!path.steal())
       return NULL;
     m.acquire();
-    Space* s = path.steal(*this,d);
+    Space* s = path.steal(*this,d,n);
     m.release();
     // Tell that there will be one more busy worker
     if (s != NULL) 
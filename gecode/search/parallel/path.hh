@@ -54,6 +54,10 @@ namespace Gecode { namespace Search { namespace Parallel {
    * distance is at least this large, an additional
    * clone is created.
    *
+   * The path also supports limited discrepancy search: taking
+   * alternative \f$i\f$ of a choice counts as \f$i\f$ discrepancies and
+   * alternatives that exceed the discrepancy limit are not explored.
+   *
    */
   class Path {
   public:
@@ -71,8 +75,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     public:
       /// Default constructor
       Edge(void);
-      /// Edge for space \a s with clone \a c (possibly NULL)
-      Edge(Space* s, Space* c);
+      /// Edge for space \a s with clone \a c (possibly NULL) and at most \a d discrepancies
+      Edge(Space* s, Space* c, unsigned int d);
       
       /// Return space for edge
       Space* space(void) const;
@@ -88,6 +92,8 @@ namespace Gecode { namespace Search { namespace Parallel {
       bool rightmost(void) const;
       /// Test whether there is an alternative that can be stolen
       bool work(void) const;
+      /// Test whether alternatives are not explored due to the discrepancy limit
+      bool truncated(void) const;
       /// Move to next alternative
       void next(void);
       /// Steal rightmost alternative and return its number
@@ -101,6 +107,12 @@ namespace Gecode { namespace Search { namespace Parallel {
     Support::DynamicStack<Edge,Heap> ds;
     /// Number of edges that have work for stealing
     unsigned int n_work;
+    /// Number of discrepancies of the current node
+    unsigned int n_d;
+    /// Discrepancy limit
+    unsigned int d_l;
+    /// Whether alternatives have not been explored due to the discrepancy limit
+    bool d_t;
   public:
     /// Initialize
     Path(void);
@@ -127,12 +139,24 @@ namespace Gecode { namespace Search { namespace Parallel {
     int entries(void) const;
     /// Return size used
     size_t size(void) const;
-    /// Reset stack
-    void reset(void);
+    /// Reset stack and set number of discrepancies of the root to \a n
+    void reset(unsigned int n=0);
     /// Make a quick check whether stealing might be feasible
     bool steal(void) const;
-    /// Steal work at depth \a d
-    Space* steal(Worker& stat, unsigned long int& d);
+    /// Steal work at depth \a d with \a n discrepancies
+    Space* steal(Worker& stat, unsigned long int& d, unsigned int& n);
+    /// Constrain all clones by \a best and return whether the current node has been pruned
+    bool prune(Worker& stat, const Space& best);
+    /// Return number of discrepancies of the current node
+    unsigned int discrepancies(void) const;
+    /// Return discrepancy limit
+    unsigned int limit(void) const;
+    /// Set discrepancy limit to \a l
+    void limit(unsigned int l);
+    /// Test whether alternatives have not been explored due to the discrepancy limit
+    bool truncated(void) const;
+    /// Test whether the current node has been explored with a smaller discrepancy limit
+    bool repeated(void) const;
   };
 
 
@@ -144,9 +168,9 @@ namespace Gecode { namespace Search { namespace Parallel {
   Path::Edge::Edge(void) {}
 
   forceinline
-  Path::Edge::Edge(Space* s, Space* c)
+  Path::Edge::Edge(Space* s, Space* c, unsigned int d)
     : _space(c), _alt(0), _choice(s->choice()) {
-    _alt_max = _choice->alternatives()-1;
+    _alt_max = std::min(_choice->alternatives()-1,d);
   }
 
   forceinline Space*
@@ -170,6 +194,10 @@ namespace Gecode { namespace Search { namespace Parallel {
   Path::Edge::work(void) const {
     return _alt != _alt_max;
   }
+  forceinline bool
+  Path::Edge::truncated(void) const {
+    return _alt_max+1 < _choice->alternatives();
+  }
   forceinline void
   Path::Edge::next(void) {
     _alt++;
@@ -199,11 +227,14 @@ namespace Gecode { namespace Search { namespace Parallel {
    */
 
   forceinline
-  Path::Path(void) : ds(heap), n_work(0) {}
+  Path::Path(void)
+    : ds(heap), n_work(0), n_d(0), d_l(UINT_MAX), d_t(false) {}
 
   forceinline const Choice*
   Path::push(Worker& stat, Space* s, Space* c) {
-    Edge sn(s,c);
+    Edge sn(s,c,d_l-n_d);
+    if (sn.truncated())
+      d_t = true;
     if (sn.work())
       n_work++;
     ds.push(sn);
@@ -215,11 +246,12 @@ namespace Gecode { namespace Search { namespace Parallel {
   Path::next(Worker& stat) {
     while (!ds.empty())
       if (ds.top().rightmost()) {
+        n_d -= ds.top().alt();
         stat.pop(ds.top().space(),ds.top().choice());
         ds.pop().dispose();
       } else {
         assert(ds.top().work());
-        ds.top().next();
+        ds.top().next(); n_d++;
         if (!ds.top().work())
           n_work--;
         return true;
@@ -269,25 +301,62 @@ namespace Gecode { namespace Search { namespace Parallel {
     for (int i=l; i<n; i++) {
       if (ds.top().work())
         n_work--;
+      n_d -= ds.top().alt();
       ds.pop().dispose();
     }
     assert(ds.entries() == l);
   }
 
+  forceinline bool
+  Path::prune(Worker& stat, const Space& best) {
+    for (int i=0; i<ds.entries(); i++)
+      if (Space* s = ds[i].space()) {
+        s->constrain(best);
+        // All nodes below a failed clone can be discarded
+        if (s->status(stat) == SS_FAILED) {
+          stat.fail++;
+          unwind(i);
+          return true;
+        }
+      }
+    return false;
+  }
+
   forceinline void
-  Path::reset(void) {
-    n_work = 0;
+  Path::reset(unsigned int n) {
+    n_work = 0; n_d = n;
     while (!ds.empty())
       ds.pop().dispose();
   }
 
+  forceinline unsigned int
+  Path::discrepancies(void) const {
+    return n_d;
+  }
+  forceinline unsigned int
+  Path::limit(void) const {
+    return d_l;
+  }
+  forceinline void
+  Path::limit(unsigned int l) {
+    d_l = l; d_t = false;
+  }
+  forceinline bool
+  Path::truncated(void) const {
+    return d_t;
+  }
+  forceinline bool
+  Path::repeated(void) const {
+    return (d_l != UINT_MAX) && (n_d < d_l);
+  }
+
   forceinline bool
   Path::steal(void) const {
     return n_work > Config::steal_limit;
   }
 
   forceinline Space*
-  Path::steal(Worker& stat, unsigned long int& d) {
+  Path::steal(Worker& stat, unsigned long int& d, unsigned int& nd) {
     // Find position to steal: leave sufficient work
     int n = ds.entries()-1;
     unsigned int w = 0;
@@ -304,9 +373,14 @@ namespace Gecode { namespace Search { namespace Parallel {
         // Recompute, if necessary
         for (int i=l; i<n; i++)
           commit(c,i);
-        c->commit(*ds[n].choice(),ds[n].steal());
+        unsigned int a = ds[n].steal();
+        c->commit(*ds[n].choice(),a);
         if (!ds[n].work())
           n_work--;
+        // Discrepancies of the stolen node
+        nd = n_d + a;
+        for (int i=n; i<ds.entries(); i++)
+          nd -= ds[i].alt();
         d = stat.steal_depth(static_cast<unsigned long int>(n+1));
         return c;
       }
@@ -337,7 +411,7 @@ namespace Gecode { namespace Search { namespace Parallel {
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = ds[l].space()->clone(true,stat); // Last clone
 
     if (d < a_d) {
       // No adaptive recomputation
@@ -367,7 +441,7 @@ namespace Gecode { namespace Search { namespace Parallel {
           unwind(i);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(true,stat));
         stat.adapt(ds[i].space());
         d = static_cast<unsigned int>(n-i);
       }
@@ -421,11 +495,11 @@ namespace Gecode { namespace Search { namespace Parallel {
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = s->clone(true,stat);
       ds[l].space(c);
       stat.constrained(s,c);
     } else {
-      s = s->clone();
+      s = s->clone(true,stat);
     }
 
     if (d < a_d) {
@@ -459,7 +533,7 @@ namespace Gecode { namespace Search { namespace Parallel {
           unwind(i);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(true,stat));
         stat.adapt(ds[i].space());
         d = static_cast<unsigned int>(n-i);
       }
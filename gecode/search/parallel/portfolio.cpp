@@ -0,0 +1,194 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/support.hh>
+
+#ifdef GECODE_HAS_THREADS
+
+#include <gecode/search/parallel/portfolio.hh>
+
+namespace Gecode { namespace Search { namespace Parallel {
+
+  /*
+   * Statistics
+   */
+  Statistics 
+  Portfolio::statistics(void) const {
+    Statistics s;
+    for (unsigned int i=0; i<workers(); i++)
+      s += asset(i)->statistics();
+    return s;
+  }
+
+
+  /*
+   * Search control
+   */
+  bool
+  Portfolio::Asset::stop(const Statistics& s, const Options& o) {
+    // Search must pause or has finished
+    if ((p.cmd() != C_WORK) || p.finished())
+      return true;
+    // A better solution has been found by some other asset
+    if (p.best_mode && (v != p.version))
+      return true;
+    // Some other asset has found the first solution
+    if (!p.best_mode && (p.winner != NULL) && (p.winner != this))
+      return true;
+    s_o = (p.opt().stop != NULL) && p.opt().stop->stop(s,o);
+    return s_o;
+  }
+
+  void
+  Portfolio::solution(Asset& a, Space* s) {
+    m_search.acquire();
+    if (best_mode) {
+      if (best != NULL) {
+        s->constrain(*best);
+        if (s->status() == SS_FAILED) {
+          delete s;
+          m_search.release();
+          return;
+        }
+        delete best;
+      }
+      // The best solution is accessed by all assets
+      best = s->clone(false);
+      a.v = ++version;
+    } else if (winner == NULL) {
+      winner = &a;
+    } else if (winner != &a) {
+      delete s;
+      m_search.release();
+      return;
+    }
+    bool bs = signal();
+    solutions.push(s);
+    if (bs)
+      e_search.signal();
+    m_search.release();
+  }
+
+  void
+  Portfolio::update(Asset& a) {
+    m_search.acquire();
+    if (best_mode) {
+      if (a.v != version) {
+        static_cast<BABEngine*>(a.e)->constrain(*best);
+        a.v = version;
+      }
+    } else if ((winner != NULL) && (winner != &a)) {
+      // The asset has lost, its engine is not needed any longer
+      a.dispose();
+    }
+    m_search.release();
+  }
+
+  void
+  Portfolio::exhausted(Asset& a) {
+    m_search.acquire();
+    if (best_mode || (winner == NULL) || (winner == &a)) {
+      // The first asset to finish its search tree finishes search
+      bool bs = signal();
+      n_busy = 0;
+      if (bs)
+        e_search.signal();
+    }
+    a.dispose();
+    m_search.release();
+  }
+
+
+  /*
+   * Actual work
+   */
+  void
+  Portfolio::Asset::run(void) {
+    while (true) {
+      switch (p.cmd()) {
+      case C_WAIT:
+        // Wait
+        p.wait();
+        break;
+      case C_TERMINATE:
+        // Acknowledge termination request
+        p.ack_terminate();
+        // Wait until termination can proceed
+        p.wait_terminate();
+        // Terminate thread
+        p.terminated();
+        return;
+      case C_WORK:
+        if ((e == NULL) || p.finished()) {
+          // Nothing to do, do not compete with the other assets
+          Support::Thread::sleep(Config::initial_delay);
+        } else if (Space* s = e->next()) {
+          p.solution(*this,s);
+        } else if (!e->stopped()) {
+          p.exhausted(*this);
+        } else if (s_o) {
+          s_o = false;
+          p.stop();
+        } else {
+          p.update(*this);
+        }
+        break;
+      default:
+        GECODE_NEVER;
+      }
+    }
+  }
+
+
+  /*
+   * Termination and deletion
+   */
+  Portfolio::Asset::~Asset(void) {
+    delete e;
+  }
+
+  Portfolio::~Portfolio(void) {
+    terminate();
+    heap.rfree(_asset);
+    delete best;
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-parallel
@@ -0,0 +1,220 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_PARALLEL_PORTFOLIO_HH__
+#define __GECODE_SEARCH_PARALLEL_PORTFOLIO_HH__
+
+#include <gecode/search/parallel/engine.hh>
+#include <gecode/search/sequential/dfs.hh>
+#include <gecode/search/sequential/bab.hh>
+
+namespace Gecode { namespace Search { namespace Parallel {
+
+  /// %Portfolio search engine running one asset per thread
+  class Portfolio : public Engine {
+  protected:
+    /// Sequential branch-and-bound engine that accepts better solutions
+    class BABEngine : public WorkerToEngine<Sequential::BAB> {
+    public:
+      /// Initialize for space \a s (of size \a sz) with options \a o
+      BABEngine(Space* s, size_t sz, const Options& o);
+      /// Constrain future solutions to be better than \a b
+      void constrain(const Space& b);
+    };
+    /**
+     * \brief Asset of a portfolio
+     *
+     * An asset performs sequential search on its own copy of the
+     * root space in its own thread. The asset also serves as stop
+     * object for its engine: search is interrupted as soon as the
+     * asset must react to another asset.
+     */
+    class Asset : public Support::Runnable, public Search::Stop {
+    public:
+      /// Reference to portfolio
+      Portfolio& p;
+      /// Mutex for access to engine and statistics
+      Support::Mutex m;
+      /// Search options (with the asset as stop object)
+      Options opt;
+      /// Sequential search engine (NULL if asset has no more work)
+      Search::Engine* e;
+      /// Statistics of engines already deleted
+      Statistics stat;
+      /// Version of best solution the asset has been constrained with
+      unsigned long int v;
+      /// Whether the asset has been stopped by the stop object of the options
+      bool s_o;
+      /// Initialize for space \a s (of size \a sz) with portfolio \a p
+      Asset(Space* s, size_t sz, Portfolio& p);
+      /// Stop search if asset must react to other assets or search must stop
+      virtual bool stop(const Statistics& s, const Options& o);
+      /// Return statistics
+      Statistics statistics(void);
+      /// Start execution of asset
+      virtual void run(void);
+      /// Delete engine
+      void dispose(void);
+      /// Destructor
+      virtual ~Asset(void);
+    };
+    /// Array of assets
+    Asset** _asset;
+    /// Whether assets search for best solutions
+    const bool best_mode;
+    /// Best solution so far (for branch-and-bound)
+    Space* best;
+    /// Version of best solution, incremented for every better solution
+    volatile unsigned long int version;
+    /// Asset that found the first solution (for depth-first search)
+    Asset* volatile winner;
+    /// Return whether search is finished
+    bool finished(void) const;
+    /// Report solution \a s found by asset \a a
+    void solution(Asset& a, Space* s);
+    /// Let asset \a a react to other assets after it has been stopped
+    void update(Asset& a);
+    /// Report that asset \a a has explored its entire search tree
+    void exhausted(Asset& a);
+  public:
+    /// Provide access to asset \a i
+    Asset* asset(unsigned int i) const;
+    /// Initialize for space \a s (of size \a sz) with options \a o
+    Portfolio(Space* s, size_t sz, const Options& o, bool best);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Destructor
+    virtual ~Portfolio(void);
+  };
+
+
+  /*
+   * Branch-and-bound engine
+   */
+  forceinline
+  Portfolio::BABEngine::BABEngine(Space* s, size_t sz, const Options& o)
+    : WorkerToEngine<Sequential::BAB>(s,sz,o) {}
+  forceinline void
+  Portfolio::BABEngine::constrain(const Space& b) {
+    w.constrain(b);
+  }
+
+
+  /*
+   * Basic access routines
+   */
+  forceinline Portfolio::Asset*
+  Portfolio::asset(unsigned int i) const {
+    return _asset[i];
+  }
+  forceinline bool
+  Portfolio::finished(void) const {
+    return n_busy == 0;
+  }
+
+
+  /*
+   * Assets
+   */
+  forceinline
+  Portfolio::Asset::Asset(Space* s, size_t sz, Portfolio& p0)
+    : p(p0), opt(p0.opt()), e(NULL), v(0UL), s_o(false) {
+    opt.clone = false;
+    opt.threads = 1.0;
+    opt.stop = this;
+    if (s == NULL)
+      return;
+    if (p.best_mode)
+      e = new BABEngine(s,sz,opt);
+    else
+      e = new WorkerToEngine<Sequential::DFS>(s,sz,opt);
+  }
+  forceinline Statistics
+  Portfolio::Asset::statistics(void) {
+    m.acquire();
+    Statistics s(stat);
+    if (e != NULL)
+      s += e->statistics();
+    m.release();
+    return s;
+  }
+  forceinline void
+  Portfolio::Asset::dispose(void) {
+    m.acquire();
+    stat += e->statistics();
+    delete e;
+    e = NULL;
+    m.release();
+  }
+
+
+  /*
+   * Engine: initialization
+   */
+  forceinline
+  Portfolio::Portfolio(Space* s, size_t sz, const Options& o, bool b)
+    : Engine(o), best_mode(b), best(NULL), version(0UL), winner(NULL) {
+    // Create assets
+    _asset = static_cast<Asset**>
+      (heap.ralloc(workers() * sizeof(Asset*)));
+    if (s->status() == SS_FAILED) {
+      // No asset has work to do
+      n_busy = 0;
+      for (unsigned int i=0; i<workers(); i++)
+        _asset[i] = new Asset(NULL,sz,*this);
+    } else {
+      // Every asset gets its own copy of the root space
+      for (unsigned int i=0; i<workers(); i++) {
+        Space* c = s->clone(false);
+        c->asset(i);
+        _asset[i] = new Asset(c,sz,*this);
+      }
+    }
+    if (!o.clone)
+      delete s;
+    // Block all assets
+    block();
+    // Create and start threads
+    for (unsigned int i=0; i<workers(); i++)
+      Support::Thread::run(_asset[i]);
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-parallel
@@ -69,6 +69,8 @@ namespace Gecode { namespace Search { namespace Sequential {
     BAB(Space* s, size_t sz, const Options& o);
     /// %Search for next better solution
     Space* next(void);
+    /// Constrain future solutions to be better than \a b
+    void constrain(const Space& b);
     /// Return statistics
     Statistics statistics(void) const;
     /// Destructor
@@ -129,7 +131,7 @@ namespace Gecode { namespace Search { namespace Sequential {
           {
             Space* c;
             if ((d == 0) || (d >= opt.c_d)) {
-              c = cur->clone();
+              c = cur->clone(true,*this);
               d = 1;
             } else {
               c = NULL;
@@ -156,6 +158,15 @@ namespace Gecode { namespace Search { namespace Sequential {
     return NULL;
   }
 
+  forceinline void
+  BAB::constrain(const Space& b) {
+    delete best;
+    best = b.clone(false);
+    mark = path.entries();
+    if (cur != NULL)
+      cur->constrain(*best);
+  }
+
   forceinline Statistics
   BAB::statistics(void) const {
     Statistics s = *this;
@@ -130,7 +130,7 @@ namespace Gecode { namespace Search { namespace Sequential {
           {
             Space* c;
             if ((d == 0) || (d >= opt.c_d)) {
-              c = cur->clone();
+              c = cur->clone(true,*this);
               d = 1;
             } else {
               c = NULL;
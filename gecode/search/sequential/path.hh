@@ -54,6 +54,10 @@ namespace Gecode { namespace Search { namespace Sequential {
    * distance is at least this large, an additional
    * clone is created.
    *
+   * The path also supports limited discrepancy search: taking
+   * alternative \f$i\f$ of a choice counts as \f$i\f$ discrepancies and
+   * alternatives that exceed the discrepancy limit are not explored.
+   *
    */
   class Path {
   public:
@@ -64,13 +68,15 @@ namespace Gecode { namespace Search { namespace Sequential {
       Space* _space;
       /// Current alternative
       unsigned int _alt;
+      /// Last alternative to be explored
+      unsigned int _alt_max;
       /// Choice
       const Choice* _choice;
     public:
       /// Default constructor
       Edge(void);
-      /// Edge for space \a s with clone \a c (possibly NULL)
-      Edge(Space* s, Space* c);
+      /// Edge for space \a s with clone \a c (possibly NULL) and at most \a d discrepancies
+      Edge(Space* s, Space* c, unsigned int d);
       
       /// Return space for edge
       Space* space(void) const;
@@ -84,6 +90,8 @@ namespace Gecode { namespace Search { namespace Sequential {
       unsigned int alt(void) const;
       /// Test whether current alternative is rightmost
       bool rightmost(void) const;
+      /// Test whether alternatives are not explored due to the discrepancy limit
+      bool truncated(void) const;
       /// Move to next alternative
       void next(void);
       
@@ -93,6 +101,12 @@ namespace Gecode { namespace Search { namespace Sequential {
   protected:
     /// Stack to store edge information
     Support::DynamicStack<Edge,Heap> ds;
+    /// Number of discrepancies of the current node
+    unsigned int n_d;
+    /// Discrepancy limit
+    unsigned int d_l;
+    /// Whether alternatives have not been explored due to the discrepancy limit
+    bool d_t;
   public:
     /// Initialize
     Path(void);
@@ -121,6 +135,16 @@ namespace Gecode { namespace Search { namespace Sequential {
     size_t size(void) const;
     /// Reset stack
     void reset(void);
+    /// Return number of discrepancies of the current node
+    unsigned int discrepancies(void) const;
+    /// Return discrepancy limit
+    unsigned int limit(void) const;
+    /// Set discrepancy limit to \a l
+    void limit(unsigned int l);
+    /// Test whether alternatives have not been explored due to the discrepancy limit
+    bool truncated(void) const;
+    /// Test whether the current node has been explored with a smaller discrepancy limit
+    bool repeated(void) const;
   };
 
 
@@ -132,8 +156,10 @@ namespace Gecode { namespace Search { namespace Sequential {
   Path::Edge::Edge(void) {}
 
   forceinline
-  Path::Edge::Edge(Space* s, Space* c)
-    : _space(c), _alt(0), _choice(s->choice()) {}
+  Path::Edge::Edge(Space* s, Space* c, unsigned int d)
+    : _space(c), _alt(0), _choice(s->choice()) {
+    _alt_max = std::min(_choice->alternatives()-1,d);
+  }
 
   forceinline Space*
   Path::Edge::space(void) const {
@@ -150,7 +176,11 @@ namespace Gecode { namespace Search { namespace Sequential {
   }
   forceinline bool
   Path::Edge::rightmost(void) const {
-    return _alt+1 == _choice->alternatives();
+    return _alt == _alt_max;
+  }
+  forceinline bool
+  Path::Edge::truncated(void) const {
+    return _alt_max+1 < _choice->alternatives();
   }
   forceinline void
   Path::Edge::next(void) {
@@ -176,11 +206,13 @@ namespace Gecode { namespace Search { namespace Sequential {
    */
 
   forceinline
-  Path::Path(void) : ds(heap) {}
+  Path::Path(void) : ds(heap), n_d(0), d_l(UINT_MAX), d_t(false) {}
 
   forceinline const Choice*
   Path::push(Worker& stat, Space* s, Space* c) {
-    Edge sn(s,c);
+    Edge sn(s,c,d_l-n_d);
+    if (sn.truncated())
+      d_t = true;
     ds.push(sn);
     stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
     return sn.choice();
@@ -190,10 +222,11 @@ namespace Gecode { namespace Search { namespace Sequential {
   Path::next(Worker& stat) {
     while (!ds.empty())
       if (ds.top().rightmost()) {
+        n_d -= ds.top().alt();
         stat.pop(ds.top().space(),ds.top().choice());
         ds.pop().dispose();
       } else {
-        ds.top().next();
+        ds.top().next(); n_d++;
         return true;
       }
     return false;
@@ -238,17 +271,41 @@ namespace Gecode { namespace Search { namespace Sequential {
   Path::unwind(int l) {
     assert((ds[l].space() == NULL) || ds[l].space()->failed());
     int n = ds.entries();
-    for (int i=l; i<n; i++)
+    for (int i=l; i<n; i++) {
+      n_d -= ds.top().alt();
       ds.pop().dispose();
+    }
     assert(ds.entries() == l);
   }
 
   inline void
   Path::reset(void) {
+    n_d = 0;
     while (!ds.empty())
       ds.pop().dispose();
   }
 
+  forceinline unsigned int
+  Path::discrepancies(void) const {
+    return n_d;
+  }
+  forceinline unsigned int
+  Path::limit(void) const {
+    return d_l;
+  }
+  forceinline void
+  Path::limit(unsigned int l) {
+    d_l = l; d_t = false;
+  }
+  forceinline bool
+  Path::truncated(void) const {
+    return d_t;
+  }
+  forceinline bool
+  Path::repeated(void) const {
+    return (d_l != UINT_MAX) && (n_d < d_l);
+  }
+
   forceinline Space*
   Path::recompute(unsigned int& d, unsigned int a_d, Worker& stat) {
     assert(!ds.empty());
@@ -271,7 +328,7 @@ namespace Gecode { namespace Search { namespace Sequential {
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = ds[l].space()->clone(true,stat); // Last clone
 
     if (d < a_d) {
       // No adaptive recomputation
@@ -301,7 +358,7 @@ namespace Gecode { namespace Search { namespace Sequential {
           unwind(i);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(true,stat));
         stat.adapt(ds[i].space());
         d = static_cast<unsigned int>(n-i);
       }
@@ -355,11 +412,11 @@ namespace Gecode { namespace Search { namespace Sequential {
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = s->clone(true,stat);
       ds[l].space(c);
       stat.constrained(s,c);
     } else {
-      s = s->clone();
+      s = s->clone(true,stat);
     }
 
     if (d < a_d) {
@@ -393,7 +450,7 @@ namespace Gecode { namespace Search { namespace Sequential {
           unwind(i);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(true,stat));
         stat.adapt(ds[i].space());
         d = static_cast<unsigned int>(n-i);
       }
@@ -0,0 +1,190 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_SEQUENTIAL_TRAIL_DFS_HH__
+#define __GECODE_SEARCH_SEQUENTIAL_TRAIL_DFS_HH__
+
+#include <gecode/search.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/worker.hh>
+#include <gecode/search/sequential/path.hh>
+
+namespace Gecode { namespace Search { namespace Sequential {
+
+  /**
+   * \brief Depth-first search engine implementation using trailing
+   *
+   * The engine explores the search tree with a single space that is
+   * marked at each node (see Space::trail_mark) and backtracks by
+   * undoing the changes since the mark. As for depth-first search
+   * with recomputation, a clone is stored after every \a c_d commits.
+   * The clones are used for recomputation only if the changes of the
+   * space can not be undone.
+   */
+  class TrailDFS : public Worker {
+  private:
+    /// Search options
+    Options opt;
+    /// Current path in search tree
+    Path path;
+    /// Levels of the marks for the nodes on the path (-1 if not marked)
+    Support::DynamicStack<int,Heap> ml;
+    /// Current space being explored
+    Space* cur;
+    /// Whether the current space must backtrack
+    bool bt;
+    /// Distance until next clone
+    unsigned int d;
+  public:
+    /// Initialize for space \a s (of size \a sz) with options \a o
+    TrailDFS(Space* s, size_t sz, const Options& o);
+    /// %Search for next solution
+    Space* next(void);
+    /// Return statistics
+    Statistics statistics(void) const;
+    /// Destructor
+    ~TrailDFS(void);
+  };
+
+  forceinline 
+  TrailDFS::TrailDFS(Space* s, size_t sz, const Options& o)
+    : Worker(sz), opt(o), ml(heap), d(0) {
+    current(s);
+    if (s->status(*this) == SS_FAILED) {
+      fail++;
+      cur = NULL;
+      if (!o.clone)
+        delete s;
+    } else {
+      cur = snapshot(s,opt);
+    }
+    bt = (cur == NULL);
+    current(NULL);
+    current(cur);
+  }
+
+  forceinline Space*
+  TrailDFS::next(void) {
+    start();
+    while (true) {
+      while (!bt) {
+        if (stop(opt,path.size()))
+          return NULL;
+        node++;
+        switch (cur->status(*this)) {
+        case SS_FAILED:
+          fail++;
+          bt = true;
+          break;
+        case SS_SOLVED:
+          {
+            // The current space is kept for backtracking
+            Space* s = cur->clone(true,*this);
+            // Deletes all pending branchers
+            (void) s->choice();
+            bt = true;
+            return s;
+          }
+        case SS_BRANCH:
+          {
+            Space* c;
+            if ((d == 0) || (d >= opt.c_d)) {
+              c = cur->clone(true,*this);
+              d = 1;
+            } else {
+              c = NULL;
+              d++;
+            }
+            const Choice* ch = path.push(*this,cur,c);
+            Worker::push(c,ch);
+            ml.push(static_cast<int>(cur->trail_mark()));
+            cur->commit(*ch,0);
+            break;
+          }
+        default:
+          GECODE_NEVER;
+        }
+      }
+      Worker::current(NULL);
+      do {
+        if (!path.next(*this)) {
+          delete cur;
+          cur = NULL;
+          return NULL;
+        }
+        int n = path.entries();
+        while (ml.entries() > n)
+          (void) ml.pop();
+        if ((cur != NULL) && (ml.top() >= 0) &&
+            cur->trail_undo(static_cast<unsigned int>(ml.top()))) {
+          // Backtrack by undoing
+          path.commit(cur,n-1);
+          d = static_cast<unsigned int>(n - path.lc());
+        } else {
+          // Backtrack by recomputation
+          delete cur;
+          cur = path.recompute(d,opt.a_d,*this);
+          // The recomputed space has not been marked
+          for (int i=ml.entries(); i--; )
+            ml[i] = -1;
+        }
+      } while (cur == NULL);
+      Worker::current(cur);
+      bt = false;
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  forceinline Statistics
+  TrailDFS::statistics(void) const {
+    Statistics s = *this;
+    s.memory += path.size() + ml.size();
+    return s;
+  }
+
+  forceinline 
+  TrailDFS::~TrailDFS(void) {
+    delete cur;
+    path.reset();
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-sequential
@@ -42,6 +42,7 @@ namespace Gecode { namespace Search {
   forceinline void
   Statistics::reset(void) {
     StatusStatistics::reset();
+    CloneStatistics::reset();
     fail=0; node=0; depth=0; memory=0;
   }
 
@@ -52,6 +53,7 @@ namespace Gecode { namespace Search {
   forceinline Statistics&
   Statistics::operator +=(const Statistics& s) {
     (void) StatusStatistics::operator +=(s);
+    (void) CloneStatistics::operator +=(s);
     fail += s.fail;
     node += s.node;
     depth = std::max(depth,s.depth);
@@ -1105,6 +1105,64 @@ namespace Gecode {
     init(Home, const SetVarArgs& x, double d);
   };
 
+  /// Recording conflict history based scores for set variables
+  class SetCHB : public CHB {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized score storage is init or the assignment operator.
+     *
+     */
+    SetCHB(void);
+    /// Copy constructor
+    SetCHB(const SetCHB& a);
+    /// Assignment operator
+    SetCHB& operator =(const SetCHB& a);
+    /// Initialize for set variables \a x
+    GECODE_SET_EXPORT
+    SetCHB(Home home, const SetVarArgs& x);
+    /**
+     * \brief Initialize for set variables \a x
+     *
+     * This member function can only be used once and only if the
+     * score storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_SET_EXPORT void
+    init(Home home, const SetVarArgs& x);
+  };
+
+  /// Recording weighted degrees for set variables
+  class SetWDeg : public WDeg {
+  public:
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized weight storage is init or the assignment operator.
+     *
+     */
+    SetWDeg(void);
+    /// Copy constructor
+    SetWDeg(const SetWDeg& a);
+    /// Assignment operator
+    SetWDeg& operator =(const SetWDeg& a);
+    /// Initialize for set variables \a x
+    GECODE_SET_EXPORT
+    SetWDeg(Home home, const SetVarArgs& x);
+    /**
+     * \brief Initialize for set variables \a x
+     *
+     * This member function can only be used once and only if the
+     * weight storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_SET_EXPORT void
+    init(Home home, const SetVarArgs& x);
+  };
+
   //@{
   /// Which variable to select for branching
   enum SetVarBranch {
@@ -1116,6 +1174,10 @@ namespace Gecode {
     SET_VAR_AFC_MAX,    ///< With largest accumulated failure count
     SET_VAR_ACTIVITY_MIN, ///< With lowest activity
     SET_VAR_ACTIVITY_MAX, ///< With highest activity
+    SET_VAR_CHB_MIN,    ///< With lowest conflict history score
+    SET_VAR_CHB_MAX,    ///< With highest conflict history score
+    SET_VAR_WDEG_MIN,   ///< With smallest weighted degree
+    SET_VAR_WDEG_MAX,   ///< With largest weighted degree
     SET_VAR_MIN_MIN,    ///< With smallest minimum unknown element
     SET_VAR_MIN_MAX,    ///< With largest minimum unknown element
     SET_VAR_MAX_MIN,    ///< With smallest maximum unknown element
@@ -1127,7 +1189,9 @@ namespace Gecode {
     SET_VAR_SIZE_AFC_MIN, ///< With smallest domain size divided by accumulated failure count
     SET_VAR_SIZE_AFC_MAX, ///< With largest domain size divided by accumulated failure count
     SET_VAR_SIZE_ACTIVITY_MIN, ///< With smallest domain size divided by activity
-    SET_VAR_SIZE_ACTIVITY_MAX  ///< With largest domain size divided by activity
+    SET_VAR_SIZE_ACTIVITY_MAX, ///< With largest domain size divided by activity
+    SET_VAR_SIZE_WDEG_MIN, ///< With smallest domain size divided by weighted degree
+    SET_VAR_SIZE_WDEG_MAX  ///< With largest domain size divided by weighted degree
   };
 
   /// Which values to select first for branching
@@ -1191,6 +1255,8 @@ namespace Gecode {
 }
 
 #include <gecode/set/activity.hpp>
+#include <gecode/set/chb.hpp>
+#include <gecode/set/wdeg.hpp>
 
 #endif
 
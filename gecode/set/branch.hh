@@ -485,6 +485,64 @@ namespace Gecode { namespace Set { namespace Branch {
     void dispose(Space& home);
   };
 
+  /**
+   * \brief View selection class for view with smallest size divided by weighted degree
+   *
+   * Requires \code #include <gecode/set/branch.hh> \endcode
+   * \ingroup FuncIntSelView
+   */
+  class BySizeWDegMin : public ViewSelBase<SetView> {
+  protected:
+    /// Weighted degree information
+    WDeg wdeg;
+    /// So-far smallest size/weighted degree
+    double sizewdeg;
+  public:
+    /// Default constructor
+    BySizeWDegMin(void);
+    /// Constructor for initialization
+    BySizeWDegMin(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, SetView x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, SetView x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, BySizeWDegMin& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
+  /**
+   * \brief View selection class for view with largest size divided by weighted degree
+   *
+   * Requires \code #include <gecode/set/branch.hh> \endcode
+   * \ingroup FuncIntSelView
+   */
+  class BySizeWDegMax : public ViewSelBase<SetView> {
+  protected:
+    /// Weighted degree information
+    WDeg wdeg;
+    /// So-far largest size/weighted degree
+    double sizewdeg;
+  public:
+    /// Default constructor
+    BySizeWDegMax(void);
+    /// Constructor for initialization
+    BySizeWDegMax(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x at position \a i
+    ViewSelStatus init(Space& home, SetView x, int i);
+    /// Possibly select better view \a x at position \a i
+    ViewSelStatus select(Space& home, SetView x, int i);
+    /// Updating during cloning
+    void update(Space& home, bool share, BySizeWDegMax& vs);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
+
 }}}
 
 #include <gecode/set/branch/select-val.hpp>
@@ -43,11 +43,15 @@
 
 namespace Gecode { namespace Set { namespace Branch {
 
-  /// Post brancher according to \a v and \a vals
-  template<class SelView>
+  /// Post brancher according to \a vs, \a vals, and \a o_vars
+  template<class ViewSel>
   void
-  post(Space& home, ViewArray<SetView>& x, SelView& v,
-       SetValBranch vals, const ValBranchOptions& o_vals, BranchFilter bf) {
+  post(Space& home, ViewArray<SetView>& x, ViewSel& vs,
+       SetValBranch vals, const ValBranchOptions& o_vals,
+       const VarBranchOptions& o_vars) {
+    typedef ViewSelLastConflict<ViewSel> SelView;
+    SelView v(home,vs,o_vars);
+    BranchFilter bf = o_vars.bf;
     switch (vals) {
     case SET_VAL_MIN_INC:
       {
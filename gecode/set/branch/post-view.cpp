@@ -70,6 +70,18 @@ namespace Gecode { namespace Set { namespace Branch {
     case SET_VAR_ACTIVITY_MAX:
       v = new (home) ViewSelVirtual<ViewSelActivityMax<SetView> >(home,o_vars);
       break;
+    case SET_VAR_CHB_MIN:
+      v = new (home) ViewSelVirtual<ViewSelCHBMin<SetView> >(home,o_vars);
+      break;
+    case SET_VAR_CHB_MAX:
+      v = new (home) ViewSelVirtual<ViewSelCHBMax<SetView> >(home,o_vars);
+      break;
+    case SET_VAR_WDEG_MIN:
+      v = new (home) ViewSelVirtual<ViewSelWDegMin<SetView> >(home,o_vars);
+      break;
+    case SET_VAR_WDEG_MAX:
+      v = new (home) ViewSelVirtual<ViewSelWDegMax<SetView> >(home,o_vars);
+      break;
     case SET_VAR_MIN_MIN:
       v = new (home) ViewSelVirtual<ByMinMin>(home,o_vars);
       break;
@@ -106,6 +118,12 @@ namespace Gecode { namespace Set { namespace Branch {
     case SET_VAR_SIZE_ACTIVITY_MAX:
       v = new (home) ViewSelVirtual<BySizeActivityMax>(home,o_vars);
       break;
+    case SET_VAR_SIZE_WDEG_MIN:
+      v = new (home) ViewSelVirtual<BySizeWDegMin>(home,o_vars);
+      break;
+    case SET_VAR_SIZE_WDEG_MAX:
+      v = new (home) ViewSelVirtual<BySizeWDegMax>(home,o_vars);
+      break;
     default:
       throw UnknownBranching("Set::branch");
     }
@@ -129,126 +147,171 @@ namespace Gecode {
     if (o_vars.activity.initialized() &&
         (o_vars.activity.size() != x.size()))
       throw ActivityWrongArity("branch");
+    if (o_vars.chb.initialized() &&
+        (o_vars.chb.size() != x.size()))
+      throw CHBWrongArity("branch");
+    if (o_vars.wdeg.initialized() &&
+        (o_vars.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch");
+    if (o_vars.impact.initialized() &&
+        (o_vars.impact.size() != x.size()))
+      throw ImpactWrongArity("branch");
     ViewArray<SetView> xv(home,x);
     switch (vars) {
     case SET_VAR_NONE:
       {
         ViewSelNone<SetView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_RND:
       {
         ViewSelRnd<SetView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_DEGREE_MIN:
       {
         ViewSelDegreeMin<SetView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_DEGREE_MAX:
       {
         ViewSelDegreeMax<SetView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_AFC_MIN:
       {
         ViewSelAfcMin<SetView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_AFC_MAX:
       {
         ViewSelAfcMax<SetView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_ACTIVITY_MIN:
       {
         ViewSelActivityMin<SetView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_ACTIVITY_MAX:
       {
         ViewSelActivityMax<SetView> v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case SET_VAR_CHB_MIN:
+      {
+        ViewSelCHBMin<SetView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case SET_VAR_CHB_MAX:
+      {
+        ViewSelCHBMax<SetView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case SET_VAR_WDEG_MIN:
+      {
+        ViewSelWDegMin<SetView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case SET_VAR_WDEG_MAX:
+      {
+        ViewSelWDegMax<SetView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_MIN_MIN:
       {
         ByMinMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_MIN_MAX:
       {
         ByMinMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_MAX_MIN:
       {
         ByMaxMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_MAX_MAX:
       {
         ByMaxMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_SIZE_MIN:
       {
         BySizeMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_SIZE_MAX:
       {
         BySizeMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_SIZE_DEGREE_MIN:
       {
         BySizeDegreeMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_SIZE_DEGREE_MAX:
       {
         BySizeDegreeMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_SIZE_AFC_MIN:
       {
         BySizeAfcMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_SIZE_AFC_MAX:
       {
         BySizeAfcMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_SIZE_ACTIVITY_MIN:
       {
         BySizeActivityMin v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     case SET_VAR_SIZE_ACTIVITY_MAX:
       {
         BySizeActivityMax v(home,o_vars);
-        post(home,xv,v,vals,o_vals,o_vars.bf);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case SET_VAR_SIZE_WDEG_MIN:
+      {
+        BySizeWDegMin v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
+      }
+      break;
+    case SET_VAR_SIZE_WDEG_MAX:
+      {
+        BySizeWDegMax v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars);
       }
       break;
     default:
@@ -276,15 +339,51 @@ namespace Gecode {
     if (o_vars.a.activity.initialized() &&
         (o_vars.a.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option a)");
+    if (o_vars.a.chb.initialized() &&
+        (o_vars.a.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option a)");
+    if (o_vars.a.wdeg.initialized() &&
+        (o_vars.a.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option a)");
+    if (o_vars.a.impact.initialized() &&
+        (o_vars.a.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option a)");
     if (o_vars.b.activity.initialized() &&
         (o_vars.b.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option b)");
+    if (o_vars.b.chb.initialized() &&
+        (o_vars.b.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option b)");
+    if (o_vars.b.wdeg.initialized() &&
+        (o_vars.b.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option b)");
+    if (o_vars.b.impact.initialized() &&
+        (o_vars.b.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option b)");
     if (o_vars.c.activity.initialized() &&
         (o_vars.c.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option c)");
+    if (o_vars.c.chb.initialized() &&
+        (o_vars.c.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option c)");
+    if (o_vars.c.wdeg.initialized() &&
+        (o_vars.c.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option c)");
+    if (o_vars.c.impact.initialized() &&
+        (o_vars.c.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option c)");
     if (o_vars.d.activity.initialized() &&
         (o_vars.d.activity.size() != x.size()))
       throw ActivityWrongArity("branch (option d)");
+    if (o_vars.d.chb.initialized() &&
+        (o_vars.d.chb.size() != x.size()))
+      throw CHBWrongArity("branch (option d)");
+    if (o_vars.d.wdeg.initialized() &&
+        (o_vars.d.wdeg.size() != x.size()))
+      throw WDegWrongArity("branch (option d)");
+    if (o_vars.d.impact.initialized() &&
+        (o_vars.d.impact.size() != x.size()))
+      throw ImpactWrongArity("branch (option d)");
     ViewArray<SetView> xv(home,x);
     Gecode::ViewSelVirtualBase<SetView>* tb[3];
     int n=0;
@@ -302,7 +401,7 @@ namespace Gecode {
         ViewSelDegreeMin<SetView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelDegreeMin<SetView>,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_DEGREE_MAX:
@@ -310,7 +409,7 @@ namespace Gecode {
         ViewSelDegreeMax<SetView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelDegreeMax<SetView>,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_AFC_MIN:
@@ -318,7 +417,7 @@ namespace Gecode {
         ViewSelAfcMin<SetView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelAfcMin<SetView>,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_AFC_MAX:
@@ -326,7 +425,7 @@ namespace Gecode {
         ViewSelAfcMax<SetView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelAfcMax<SetView>,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_ACTIVITY_MIN:
@@ -334,7 +433,7 @@ namespace Gecode {
         ViewSelActivityMin<SetView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelActivityMin<SetView>,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_ACTIVITY_MAX:
@@ -342,7 +441,39 @@ namespace Gecode {
         ViewSelActivityMax<SetView> va(home,o_vars.a);
         ViewSelTieBreakStatic<ViewSelActivityMax<SetView>,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case SET_VAR_CHB_MIN:
+      {
+        ViewSelCHBMin<SetView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelCHBMin<SetView>,
+          ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case SET_VAR_CHB_MAX:
+      {
+        ViewSelCHBMax<SetView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelCHBMax<SetView>,
+          ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case SET_VAR_WDEG_MIN:
+      {
+        ViewSelWDegMin<SetView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelWDegMin<SetView>,
+          ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case SET_VAR_WDEG_MAX:
+      {
+        ViewSelWDegMax<SetView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelWDegMax<SetView>,
+          ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_MIN_MIN:
@@ -350,7 +481,7 @@ namespace Gecode {
         ByMinMin va(home,o_vars.a);
         ViewSelTieBreakStatic<ByMinMin,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_MIN_MAX:
@@ -358,7 +489,7 @@ namespace Gecode {
         ByMinMin va(home,o_vars.a);
         ViewSelTieBreakStatic<ByMinMin,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_MAX_MIN:
@@ -366,7 +497,7 @@ namespace Gecode {
         ByMaxMin va(home,o_vars.a);
         ViewSelTieBreakStatic<ByMaxMin,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_MAX_MAX:
@@ -374,7 +505,7 @@ namespace Gecode {
         ByMaxMax va(home,o_vars.a);
         ViewSelTieBreakStatic<ByMaxMax,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_SIZE_MIN:
@@ -382,7 +513,7 @@ namespace Gecode {
         BySizeMin va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeMin,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_SIZE_MAX:
@@ -390,7 +521,7 @@ namespace Gecode {
         BySizeMax va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeMax,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_SIZE_DEGREE_MIN:
@@ -398,7 +529,7 @@ namespace Gecode {
         BySizeDegreeMin va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeDegreeMin,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_SIZE_DEGREE_MAX:
@@ -406,7 +537,7 @@ namespace Gecode {
         BySizeDegreeMax va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeDegreeMax,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_SIZE_AFC_MIN:
@@ -414,7 +545,7 @@ namespace Gecode {
         BySizeAfcMin va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeAfcMin,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_SIZE_AFC_MAX:
@@ -422,7 +553,7 @@ namespace Gecode {
         BySizeAfcMax va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeAfcMax,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_SIZE_ACTIVITY_MIN:
@@ -430,7 +561,7 @@ namespace Gecode {
         BySizeActivityMin va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeActivityMin,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     case SET_VAR_SIZE_ACTIVITY_MAX:
@@ -438,7 +569,23 @@ namespace Gecode {
         BySizeActivityMax va(home,o_vars.a);
         ViewSelTieBreakStatic<BySizeActivityMax,
           ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
-        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case SET_VAR_SIZE_WDEG_MIN:
+      {
+        BySizeWDegMin va(home,o_vars.a);
+        ViewSelTieBreakStatic<BySizeWDegMin,
+          ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
+      }
+      break;
+    case SET_VAR_SIZE_WDEG_MAX:
+      {
+        BySizeWDegMax va(home,o_vars.a);
+        ViewSelTieBreakStatic<BySizeWDegMax,
+          ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a);
       }
       break;
     default:
@@ -37,13 +37,70 @@
 
 #include <gecode/support.hh>
 
+#ifdef GECODE_HAS_UNISTD_H
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
 namespace Gecode {
 
   forceinline
-  Heap::Heap(void) {}
+  Heap::Heap(void) : cm(CM_MALLOC), cm_prefault(false) {}
 
   Heap heap;
 
+#if defined(GECODE_HAS_UNISTD_H) && defined(MAP_ANONYMOUS)
+
+  void*
+  Heap::map(size_t s) {
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_POPULATE
+    if (cm_prefault)
+      flags |= MAP_POPULATE;
+#endif
+    void* p = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    // Explicit huge pages require multiples of the huge page size
+    if ((cm == CM_HUGE) && ((s % chunk_size()) == 0))
+      p = ::mmap(NULL, s, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+#endif
+    if (p == MAP_FAILED)
+      p = ::mmap(NULL, s, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (p == MAP_FAILED)
+      throw MemoryExhausted();
+#ifdef MADV_HUGEPAGE
+    if (cm != CM_MMAP)
+      (void) ::madvise(p, s, MADV_HUGEPAGE);
+#endif
+#ifndef MAP_POPULATE
+    if (cm_prefault) {
+      long int ps = ::sysconf(_SC_PAGESIZE);
+      for (size_t i=0; i<s; i += static_cast<size_t>(ps))
+        static_cast<char*>(p)[i] = 0;
+    }
+#endif
+    return p;
+  }
+
+  void
+  Heap::unmap(void* p, size_t s) {
+    (void) ::munmap(p, s);
+  }
+
+#else
+
+  void*
+  Heap::map(size_t s) {
+    return ralloc(s);
+  }
+
+  void
+  Heap::unmap(void* p, size_t) {
+    rfree(p);
+  }
+
+#endif
+
 }
 
 // STATISTICS: support-any
@@ -56,6 +56,23 @@ namespace Gecode {
    * \ingroup FuncMemHeap
    */
   class Heap {
+  public:
+    /// How memory chunks for spaces are allocated
+    enum ChunkMode {
+      CM_MALLOC, ///< Allocate from the heap with malloc
+      CM_MMAP,   ///< Map anonymous memory
+      CM_THP,    ///< Map anonymous memory backed by transparent huge pages
+      CM_HUGE    ///< Map memory from explicitly reserved huge pages
+    };
+  private:
+    /// How memory chunks are allocated
+    ChunkMode cm;
+    /// Whether mapped memory chunks are prefaulted
+    bool cm_prefault;
+    /// Map memory chunk of size \a s
+    GECODE_SUPPORT_EXPORT void* map(size_t s);
+    /// Unmap memory chunk \a p of size \a s
+    GECODE_SUPPORT_EXPORT void unmap(void* p, size_t s);
   public:
     /// Default constructor (ensuring that only a single instance is created)
     Heap(void);
@@ -301,6 +318,38 @@ namespace Gecode {
     /// Change memory block starting at \a p to size \a s
     void* rrealloc(void* p, size_t s);
     //@}
+    /// \name Allocation of memory chunks for spaces
+    //@{
+    /**
+     * \brief Set how memory chunks are allocated
+     *
+     * The mode \a m applies to memory chunks of at least the page
+     * size. If \a pf is true, mapped memory chunks are prefaulted when
+     * they are allocated. If a mode is not supported by the platform,
+     * memory chunks are allocated with malloc (for \a CM_MMAP and
+     * \a CM_THP) or with \a CM_THP (for \a CM_HUGE).
+     *
+     * The mode should be set before any spaces are created.
+     */
+    void chunk_mode(ChunkMode m, bool pf=false);
+    /// Return how memory chunks are allocated
+    ChunkMode chunk_mode(void) const;
+    /**
+     * \brief Return preferred size of memory chunks
+     *
+     * Memory chunks backed by huge pages should be at least of the
+     * size of a huge page (zero if there is no preferred size).
+     */
+    size_t chunk_size(void) const;
+    /**
+     * \brief Allocate memory chunk of \a s bytes
+     *
+     * Sets \a m to whether the chunk has been mapped.
+     */
+    void* chunk_alloc(size_t s, bool& m);
+    /// Free memory chunk \a p of \a s bytes that has been mapped if \a m
+    void  chunk_free(void* p, size_t s, bool m);
+    //@}
   private:
     /// Allocate memory from heap (disabled)
     static void* operator new(size_t s) throw() { (void) s; return NULL; }
@@ -346,6 +395,40 @@ namespace Gecode {
   }
 
 
+  /*
+   * Allocation of memory chunks for spaces
+   *
+   */
+  forceinline void
+  Heap::chunk_mode(ChunkMode m, bool pf) {
+    cm = m; cm_prefault = pf;
+  }
+
+  forceinline Heap::ChunkMode
+  Heap::chunk_mode(void) const {
+    return cm;
+  }
+
+  forceinline size_t
+  Heap::chunk_size(void) const {
+    return ((cm == CM_THP) || (cm == CM_HUGE)) ? 2*1024*1024 : 0;
+  }
+
+  forceinline void*
+  Heap::chunk_alloc(size_t s, bool& m) {
+    m = (cm != CM_MALLOC) && (s >= 4*1024);
+    return m ? map(s) : ralloc(s);
+  }
+
+  forceinline void
+  Heap::chunk_free(void* p, size_t s, bool m) {
+    if (m)
+      unmap(p,s);
+    else
+      rfree(p);
+  }
+
+
   /*
    * Typed allocation routines
    *
@@ -39,8 +39,10 @@
 #include <sys/time.h>
 #endif
 
-#ifdef GECODE_USE_CLOCK
 #include <ctime>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
 #endif
 
 namespace Gecode { namespace Support {
@@ -66,6 +68,17 @@ namespace Gecode { namespace Support {
     double stop(void);
   };
 
+  /**
+   * \brief Return time stamp for measuring short durations
+   *
+   * Uses the time stamp counter of the processor where available and
+   * the processor time used by the program otherwise. Only differences
+   * between time stamps are meaningful.
+   *
+   * \ingroup FuncSupport
+   */
+  unsigned long int ticks(void);
+
   inline void
   Timer::start(void) {
 #if   defined(GECODE_USE_GETTIMEOFDAY)
@@ -98,6 +111,17 @@ namespace Gecode { namespace Support {
 #endif
   }
 
+  forceinline unsigned long int
+  ticks(void) {
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    return static_cast<unsigned long int>(__builtin_ia32_rdtsc());
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    return static_cast<unsigned long int>(__rdtsc());
+#else
+    return static_cast<unsigned long int>(clock());
+#endif
+  }
+
 }}
 
 // STATISTICS: support-any
@@ -163,6 +163,12 @@ namespace Test { namespace Branch {
     Gecode::INT_VAR_AFC_MAX,
     Gecode::INT_VAR_ACTIVITY_MIN,
     Gecode::INT_VAR_ACTIVITY_MAX,
+    Gecode::INT_VAR_CHB_MIN,
+    Gecode::INT_VAR_CHB_MAX,
+    Gecode::INT_VAR_WDEG_MIN,
+    Gecode::INT_VAR_WDEG_MAX,
+    Gecode::INT_VAR_IMPACT_MIN,
+    Gecode::INT_VAR_IMPACT_MAX,
     Gecode::INT_VAR_MIN_MIN,
     Gecode::INT_VAR_MIN_MAX,
     Gecode::INT_VAR_MAX_MIN,
@@ -175,6 +181,8 @@ namespace Test { namespace Branch {
     Gecode::INT_VAR_SIZE_AFC_MAX,
     Gecode::INT_VAR_SIZE_ACTIVITY_MIN,
     Gecode::INT_VAR_SIZE_ACTIVITY_MAX,
+    Gecode::INT_VAR_SIZE_WDEG_MIN,
+    Gecode::INT_VAR_SIZE_WDEG_MAX,
     Gecode::INT_VAR_REGRET_MIN_MIN,
     Gecode::INT_VAR_REGRET_MIN_MAX,
     Gecode::INT_VAR_REGRET_MAX_MIN,
@@ -194,6 +202,12 @@ namespace Test { namespace Branch {
     "INT_VAR_AFC_MAX",
     "INT_VAR_ACTIVITY_MIN",
     "INT_VAR_ACTIVITY_MAX",
+    "INT_VAR_CHB_MIN",
+    "INT_VAR_CHB_MAX",
+    "INT_VAR_WDEG_MIN",
+    "INT_VAR_WDEG_MAX",
+    "INT_VAR_IMPACT_MIN",
+    "INT_VAR_IMPACT_MAX",
     "INT_VAR_MIN_MIN",
     "INT_VAR_MIN_MAX",
     "INT_VAR_MAX_MIN",
@@ -206,6 +220,8 @@ namespace Test { namespace Branch {
     "INT_VAR_SIZE_AFC_MAX",
     "INT_VAR_SIZE_ACTIVITY_MIN",
     "INT_VAR_SIZE_ACTIVITY_MAX",
+    "INT_VAR_SIZE_WDEG_MIN",
+    "INT_VAR_SIZE_WDEG_MAX",
     "INT_VAR_REGRET_MIN_MIN",
     "INT_VAR_REGRET_MIN_MAX",
     "INT_VAR_REGRET_MAX_MIN",
@@ -221,6 +237,8 @@ namespace Test { namespace Branch {
     Gecode::INT_VAL_SPLIT_MAX,
     Gecode::INT_VAL_RANGE_MIN,
     Gecode::INT_VAL_RANGE_MAX,
+    Gecode::INT_VAL_IMPACT_MIN,
+    Gecode::INT_VAL_SOLUTION,
     Gecode::INT_VALUES_MIN,
     Gecode::INT_VALUES_MAX
   };
@@ -237,6 +255,8 @@ namespace Test { namespace Branch {
     "INT_VAL_SPLIT_MAX",
     "INT_VAL_RANGE_MIN",
     "INT_VAL_RANGE_MAX",
+    "INT_VAL_IMPACT_MIN",
+    "INT_VAL_SOLUTION",
     "INT_VALUES_MIN",
     "INT_VALUES_MAX"
   };
@@ -259,6 +279,10 @@ namespace Test { namespace Branch {
     Gecode::SET_VAR_AFC_MAX,
     Gecode::SET_VAR_ACTIVITY_MIN,
     Gecode::SET_VAR_ACTIVITY_MAX,
+    Gecode::SET_VAR_CHB_MIN,
+    Gecode::SET_VAR_CHB_MAX,
+    Gecode::SET_VAR_WDEG_MIN,
+    Gecode::SET_VAR_WDEG_MAX,
     Gecode::SET_VAR_MIN_MIN,
     Gecode::SET_VAR_MIN_MAX,
     Gecode::SET_VAR_MAX_MIN,
@@ -270,7 +294,9 @@ namespace Test { namespace Branch {
     Gecode::SET_VAR_SIZE_AFC_MIN,
     Gecode::SET_VAR_SIZE_AFC_MAX,
     Gecode::SET_VAR_SIZE_ACTIVITY_MIN,
-    Gecode::SET_VAR_SIZE_ACTIVITY_MAX
+    Gecode::SET_VAR_SIZE_ACTIVITY_MAX,
+    Gecode::SET_VAR_SIZE_WDEG_MIN,
+    Gecode::SET_VAR_SIZE_WDEG_MAX
   };
   /// Number of set variable selections
   const int n_set_var_branch =
@@ -286,6 +312,10 @@ namespace Test { namespace Branch {
     "SET_VAR_AFC_MAX",
     "SET_VAR_ACTIVITY_MIN",
     "SET_VAR_ACTIVITY_MAX",
+    "SET_VAR_CHB_MIN",
+    "SET_VAR_CHB_MAX",
+    "SET_VAR_WDEG_MIN",
+    "SET_VAR_WDEG_MAX",
     "SET_VAR_MIN_MIN",
     "SET_VAR_MIN_MAX",
     "SET_VAR_MAX_MIN",
@@ -297,7 +327,9 @@ namespace Test { namespace Branch {
     "SET_VAR_SIZE_AFC_MIN",
     "SET_VAR_SIZE_AFC_MAX",
     "SET_VAR_SIZE_ACTIVITY_MIN",
-    "SET_VAR_SIZE_ACTIVITY_MAX"
+    "SET_VAR_SIZE_ACTIVITY_MAX",
+    "SET_VAR_SIZE_WDEG_MIN",
+    "SET_VAR_SIZE_WDEG_MAX"
   };
   /// Set value selections
   const Gecode::SetValBranch set_val_branch[] = {
@@ -344,6 +376,10 @@ namespace Test { namespace Branch {
     Gecode::FLOAT_VAR_AFC_MAX,
     Gecode::FLOAT_VAR_ACTIVITY_MIN,
     Gecode::FLOAT_VAR_ACTIVITY_MAX,
+    Gecode::FLOAT_VAR_CHB_MIN,
+    Gecode::FLOAT_VAR_CHB_MAX,
+    Gecode::FLOAT_VAR_WDEG_MIN,
+    Gecode::FLOAT_VAR_WDEG_MAX,
     Gecode::FLOAT_VAR_MIN_MIN,
     Gecode::FLOAT_VAR_MIN_MAX,
     Gecode::FLOAT_VAR_MAX_MIN,
@@ -355,7 +391,9 @@ namespace Test { namespace Branch {
     Gecode::FLOAT_VAR_SIZE_AFC_MIN,
     Gecode::FLOAT_VAR_SIZE_AFC_MAX,
     Gecode::FLOAT_VAR_SIZE_ACTIVITY_MIN,
-    Gecode::FLOAT_VAR_SIZE_ACTIVITY_MAX
+    Gecode::FLOAT_VAR_SIZE_ACTIVITY_MAX,
+    Gecode::FLOAT_VAR_SIZE_WDEG_MIN,
+    Gecode::FLOAT_VAR_SIZE_WDEG_MAX
   };
   /// Number of float variable selections
   const int n_float_var_branch =
@@ -371,6 +409,10 @@ namespace Test { namespace Branch {
     "FLOAT_VAR_AFC_MAX",
     "FLOAT_VAR_ACTIVITY_MIN",
     "FLOAT_VAR_ACTIVITY_MAX",
+    "FLOAT_VAR_CHB_MIN",
+    "FLOAT_VAR_CHB_MAX",
+    "FLOAT_VAR_WDEG_MIN",
+    "FLOAT_VAR_WDEG_MAX",
     "FLOAT_VAR_MIN_MIN",
     "FLOAT_VAR_MIN_MAX",
     "FLOAT_VAR_MAX_MIN",
@@ -382,13 +424,16 @@ namespace Test { namespace Branch {
     "FLOAT_VAR_SIZE_AFC_MIN",
     "FLOAT_VAR_SIZE_AFC_MAX",
     "FLOAT_VAR_SIZE_ACTIVITY_MIN",
-    "FLOAT_VAR_SIZE_ACTIVITY_MAX"
+    "FLOAT_VAR_SIZE_ACTIVITY_MAX",
+    "FLOAT_VAR_SIZE_WDEG_MIN",
+    "FLOAT_VAR_SIZE_WDEG_MAX"
   };
   /// Float value selections
   const Gecode::FloatValBranch float_val_branch[] = {
     Gecode::FLOAT_VAL_SPLIT_MIN,
     Gecode::FLOAT_VAL_SPLIT_MAX,
-    Gecode::FLOAT_VAL_SPLIT_RND
+    Gecode::FLOAT_VAL_SPLIT_RND,
+    Gecode::FLOAT_VAL_SOLUTION
   };
   /// Number of float value selections
   const int n_float_val_branch =
@@ -397,7 +442,8 @@ namespace Test { namespace Branch {
   const char* float_val_branch_name[] = {
     "FLOAT_VAL_SPLIT_MIN",
     "FLOAT_VAL_SPLIT_MAX",
-    "FLOAT_VAL_SPLIT_RND"
+    "FLOAT_VAL_SPLIT_RND",
+    "FLOAT_VAL_SOLUTION"
   };
   //@}
 #endif
@@ -471,13 +517,34 @@ namespace Test { namespace Branch {
         for (int val = 0; val<n_int_val_branch; val++) {
           IntTestSpace* c = static_cast<IntTestSpace*>(root->clone(false));
           if (vara == 0) {
-            for (int i=0; i<c->x.size(); i++)
-              branch(*c, c->x[i], int_val_branch[val]);
+            for (int i=0; i<c->x.size(); i++) {
+              ValBranchOptions vbo;
+              if (int_val_branch[val] == INT_VAL_IMPACT_MIN) {
+                IntVarArgs y(1); y[0]=c->x[i];
+                vbo.impact = IntImpact(*c, y);
+              } else if (int_val_branch[val] == INT_VAL_SOLUTION) {
+                IntVarArgs y(1); y[0]=c->x[i];
+                vbo.phase = IntPhase(*c, y);
+              }
+              branch(*c, c->x[i], int_val_branch[val], vbo);
+            }
           } else {
             IntVarBranch ivba = int_var_branch[vara];
             IntVarBranch ivbb = int_var_branch[varb];
             VarBranchOptions vboa, vbob;
             IntActivity iaa, iab;
+            IntCHB ica, icb;
+            IntWDeg iwa, iwb;
+            // Impacts are shared by variable and value selection
+            IntImpact ii;
+            ValBranchOptions vbov;
+
+            if (int_val_branch[val] == INT_VAL_IMPACT_MIN) {
+              ii.init(*c, c->x, true);
+              vbov.impact = ii;
+            } else if (int_val_branch[val] == INT_VAL_SOLUTION) {
+              vbov.phase = IntPhase(*c, c->x);
+            }
 
             switch (ivba) {
             case INT_VAR_ACTIVITY_MIN:
@@ -487,6 +554,24 @@ namespace Test { namespace Branch {
               iaa.init(*c, c->x, 1.0);
               vboa.activity = iaa;
               break;
+            case INT_VAR_CHB_MIN:
+            case INT_VAR_CHB_MAX:
+              ica.init(*c, c->x);
+              vboa.chb = ica;
+              break;
+            case INT_VAR_WDEG_MIN:
+            case INT_VAR_WDEG_MAX:
+            case INT_VAR_SIZE_WDEG_MIN:
+            case INT_VAR_SIZE_WDEG_MAX:
+              iwa.init(*c, c->x);
+              vboa.wdeg = iwa;
+              break;
+            case INT_VAR_IMPACT_MIN:
+            case INT_VAR_IMPACT_MAX:
+              if (!ii.initialized())
+                ii.init(*c, c->x);
+              vboa.impact = ii;
+              break;
             default: ;
             }
 
@@ -498,12 +583,33 @@ namespace Test { namespace Branch {
               iab.init(*c, c->x, 1.0);
               vbob.activity = iab;
               break;
+            case INT_VAR_CHB_MIN:
+            case INT_VAR_CHB_MAX:
+              icb.init(*c, c->x);
+              vbob.chb = icb;
+              break;
+            case INT_VAR_WDEG_MIN:
+            case INT_VAR_WDEG_MAX:
+            case INT_VAR_SIZE_WDEG_MIN:
+            case INT_VAR_SIZE_WDEG_MAX:
+              iwb.init(*c, c->x);
+              vbob.wdeg = iwb;
+              break;
+            case INT_VAR_IMPACT_MIN:
+            case INT_VAR_IMPACT_MAX:
+              if (!ii.initialized())
+                ii.init(*c, c->x);
+              vbob.impact = ii;
+              break;
             default: ;
             }
 
+            // Use last conflict reasoning for some runs
+            vboa.lc = (varb == 1);
+
             branch(*c, c->x,
                    tiebreak(ivba, ivbb), int_val_branch[val],
-                   tiebreak(vboa, vbob));
+                   tiebreak(vboa, vbob), vbov);
           }
           Gecode::Search::Options o;
           results[solutions(c,o)].push_back
@@ -514,6 +620,14 @@ namespace Test { namespace Branch {
         }
       }
     }
+    {
+      // Counting-based search
+      IntTestSpace* c = static_cast<IntTestSpace*>(root->clone(false));
+      cbsbranch(*c, c->x);
+      Gecode::Search::Options o;
+      results[solutions(c,o)].push_back
+        (RunInfo("CBS","CBS","CBS",o));
+    }
     if (results.size() > 1)
       goto failed;
     delete root;
@@ -556,13 +670,34 @@ namespace Test { namespace Branch {
         for (int val = 0; val<n_int_val_branch; val++) {
           BoolTestSpace* c = static_cast<BoolTestSpace*>(root->clone(false));
           if (vara == 0) {
-            for (int i=0; i<c->x.size(); i++)
-              branch(*c, c->x[i], int_val_branch[val]);
+            for (int i=0; i<c->x.size(); i++) {
+              ValBranchOptions vbo;
+              if (int_val_branch[val] == INT_VAL_IMPACT_MIN) {
+                BoolVarArgs y(1); y[0]=c->x[i];
+                vbo.impact = BoolImpact(*c, y);
+              } else if (int_val_branch[val] == INT_VAL_SOLUTION) {
+                BoolVarArgs y(1); y[0]=c->x[i];
+                vbo.phase = BoolPhase(*c, y);
+              }
+              branch(*c, c->x[i], int_val_branch[val], vbo);
+            }
           } else {
             IntVarBranch ivba = int_var_branch[vara];
             IntVarBranch ivbb = int_var_branch[varb];
             VarBranchOptions vboa, vbob;
             BoolActivity baa, bab;
+            BoolCHB bca, bcb;
+            BoolWDeg bwa, bwb;
+            // Impacts are shared by variable and value selection
+            BoolImpact bi;
+            ValBranchOptions vbov;
+
+            if (int_val_branch[val] == INT_VAL_IMPACT_MIN) {
+              bi.init(*c, c->x, true);
+              vbov.impact = bi;
+            } else if (int_val_branch[val] == INT_VAL_SOLUTION) {
+              vbov.phase = BoolPhase(*c, c->x);
+            }
 
             switch (ivba) {
             case INT_VAR_ACTIVITY_MIN:
@@ -572,6 +707,24 @@ namespace Test { namespace Branch {
               baa.init(*c, c->x, 1.0);
               vboa.activity = baa;
               break;
+            case INT_VAR_CHB_MIN:
+            case INT_VAR_CHB_MAX:
+              bca.init(*c, c->x);
+              vboa.chb = bca;
+              break;
+            case INT_VAR_WDEG_MIN:
+            case INT_VAR_WDEG_MAX:
+            case INT_VAR_SIZE_WDEG_MIN:
+            case INT_VAR_SIZE_WDEG_MAX:
+              bwa.init(*c, c->x);
+              vboa.wdeg = bwa;
+              break;
+            case INT_VAR_IMPACT_MIN:
+            case INT_VAR_IMPACT_MAX:
+              if (!bi.initialized())
+                bi.init(*c, c->x);
+              vboa.impact = bi;
+              break;
             default: ;
             }
 
@@ -583,12 +736,33 @@ namespace Test { namespace Branch {
               bab.init(*c, c->x, 1.0);
               vbob.activity = bab;
               break;
+            case INT_VAR_CHB_MIN:
+            case INT_VAR_CHB_MAX:
+              bcb.init(*c, c->x);
+              vbob.chb = bcb;
+              break;
+            case INT_VAR_WDEG_MIN:
+            case INT_VAR_WDEG_MAX:
+            case INT_VAR_SIZE_WDEG_MIN:
+            case INT_VAR_SIZE_WDEG_MAX:
+              bwb.init(*c, c->x);
+              vbob.wdeg = bwb;
+              break;
+            case INT_VAR_IMPACT_MIN:
+            case INT_VAR_IMPACT_MAX:
+              if (!bi.initialized())
+                bi.init(*c, c->x);
+              vbob.impact = bi;
+              break;
             default: ;
             }
 
+            // Use last conflict reasoning for some runs
+            vboa.lc = (varb == 1);
+
             branch(*c, c->x,
                    tiebreak(ivba, ivbb), int_val_branch[val],
-                   tiebreak(vboa, vbob));
+                   tiebreak(vboa, vbob), vbov);
           }
           Gecode::Search::Options o;
           results[solutions(c,o)].push_back
@@ -599,6 +773,14 @@ namespace Test { namespace Branch {
         }
       }
     }
+    {
+      // Counting-based search
+      BoolTestSpace* c = static_cast<BoolTestSpace*>(root->clone(false));
+      cbsbranch(*c, c->x);
+      Gecode::Search::Options o;
+      results[solutions(c,o)].push_back
+        (RunInfo("CBS","CBS","CBS",o));
+    }
     if (results.size() > 1)
       goto failed;
     delete root;
@@ -650,6 +832,8 @@ namespace Test { namespace Branch {
             SetVarBranch svbb = set_var_branch[varb];
             VarBranchOptions vboa, vbob;
             SetActivity saa, sab;
+            SetCHB sca, scb;
+            SetWDeg swa, swb;
 
             switch (svba) {
             case SET_VAR_ACTIVITY_MIN:
@@ -659,6 +843,18 @@ namespace Test { namespace Branch {
               saa.init(*c, c->x, 1.0);
               vboa.activity = saa;
               break;
+            case SET_VAR_CHB_MIN:
+            case SET_VAR_CHB_MAX:
+              sca.init(*c, c->x);
+              vboa.chb = sca;
+              break;
+            case SET_VAR_WDEG_MIN:
+            case SET_VAR_WDEG_MAX:
+            case SET_VAR_SIZE_WDEG_MIN:
+            case SET_VAR_SIZE_WDEG_MAX:
+              swa.init(*c, c->x);
+              vboa.wdeg = swa;
+              break;
             default: ;
             }
 
@@ -670,9 +866,24 @@ namespace Test { namespace Branch {
               sab.init(*c, c->x, 1.0);
               vbob.activity = sab;
               break;
+            case SET_VAR_CHB_MIN:
+            case SET_VAR_CHB_MAX:
+              scb.init(*c, c->x);
+              vbob.chb = scb;
+              break;
+            case SET_VAR_WDEG_MIN:
+            case SET_VAR_WDEG_MAX:
+            case SET_VAR_SIZE_WDEG_MIN:
+            case SET_VAR_SIZE_WDEG_MAX:
+              swb.init(*c, c->x);
+              vbob.wdeg = swb;
+              break;
             default: ;
             }
 
+            // Use last conflict reasoning for some runs
+            vboa.lc = (varb == 1);
+
             branch(*c, c->x,
                    tiebreak(svba, svbb), set_val_branch[val],
                    tiebreak(vboa, vbob));
@@ -731,13 +942,25 @@ namespace Test { namespace Branch {
         for (int val = 0; val<n_float_val_branch; val++) {
           FloatTestSpace* c = static_cast<FloatTestSpace*>(root->clone(false));
           if (vara == 0) {
-            for (int i=0; i<c->x.size(); i++)
-              branch(*c, c->x[i], float_val_branch[val]);
+            for (int i=0; i<c->x.size(); i++) {
+              ValBranchOptions vbo;
+              if (float_val_branch[val] == FLOAT_VAL_SOLUTION) {
+                FloatVarArgs y(1); y[0]=c->x[i];
+                vbo.phase = FloatPhase(*c, y);
+              }
+              branch(*c, c->x[i], float_val_branch[val], vbo);
+            }
           } else {
             FloatVarBranch fvba = float_var_branch[vara];
             FloatVarBranch fvbb = float_var_branch[varb];
             VarBranchOptions vboa, vbob;
             FloatActivity faa, fab;
+            FloatCHB fca, fcb;
+            FloatWDeg fwa, fwb;
+            ValBranchOptions vbov;
+
+            if (float_val_branch[val] == FLOAT_VAL_SOLUTION)
+              vbov.phase = FloatPhase(*c, c->x);
 
             switch (fvba) {
             case FLOAT_VAR_ACTIVITY_MIN:
@@ -747,6 +970,18 @@ namespace Test { namespace Branch {
               faa.init(*c, c->x, 1.0);
               vboa.activity = faa;
               break;
+            case FLOAT_VAR_CHB_MIN:
+            case FLOAT_VAR_CHB_MAX:
+              fca.init(*c, c->x);
+              vboa.chb = fca;
+              break;
+            case FLOAT_VAR_WDEG_MIN:
+            case FLOAT_VAR_WDEG_MAX:
+            case FLOAT_VAR_SIZE_WDEG_MIN:
+            case FLOAT_VAR_SIZE_WDEG_MAX:
+              fwa.init(*c, c->x);
+              vboa.wdeg = fwa;
+              break;
             default: ;
             }
 
@@ -758,12 +993,27 @@ namespace Test { namespace Branch {
               fab.init(*c, c->x, 1.0);
               vbob.activity = fab;
               break;
+            case FLOAT_VAR_CHB_MIN:
+            case FLOAT_VAR_CHB_MAX:
+              fcb.init(*c, c->x);
+              vbob.chb = fcb;
+              break;
+            case FLOAT_VAR_WDEG_MIN:
+            case FLOAT_VAR_WDEG_MAX:
+            case FLOAT_VAR_SIZE_WDEG_MIN:
+            case FLOAT_VAR_SIZE_WDEG_MAX:
+              fwb.init(*c, c->x);
+              vbob.wdeg = fwb;
+              break;
             default: ;
             }
 
+            // Use last conflict reasoning for some runs
+            vboa.lc = (varb == 1);
+
             branch(*c, c->x,
                    tiebreak(fvba, fvbb), float_val_branch[val],
-                   tiebreak(vboa, vbob));
+                   tiebreak(vboa, vbob), vbov);
           }
           Gecode::Search::Options o;
           results[solutions(c,o,nbSols)].push_back
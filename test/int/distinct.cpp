@@ -112,6 +112,33 @@ namespace Test { namespace Int {
        }
      };
 
+     /// Test for detecting identical distinct constraints
+     class Identical : public Test {
+     public:
+       /// Create and register test
+       Identical(Gecode::IntConLevel icl)
+         : Test("Distinct::Identical::"+str(icl),5,-2,2,false,icl) {}
+       /// Check whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         for (int i=0; i<x.size(); i++)
+           for (int j=i+1; j<x.size(); j++)
+             if (x[i]==x[j])
+               return false;
+         return true;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         home.identical(true);
+         Gecode::IntVarArgs y(x.size());
+         for (int i=0; i<x.size(); i++)
+           y[i]=x[x.size()-1-i];
+         Gecode::distinct(home, x, icl);
+         Gecode::distinct(home, y, icl);
+         Gecode::distinct(home, x, Gecode::ICL_VAL);
+         Gecode::distinct(home, y, Gecode::ICL_BND);
+       }
+     };
+
      /// Randomized test for distinct constraint
      class Random : public Test {
      public:
@@ -229,6 +256,10 @@ namespace Test { namespace Int {
      Offset bnd_os(d,Gecode::ICL_BND);
      Offset val_os(d,Gecode::ICL_VAL);
 
+     Identical dom_i(Gecode::ICL_DOM);
+     Identical bnd_i(Gecode::ICL_BND);
+     Identical val_i(Gecode::ICL_VAL);
+
      Random dom_r(20,-50,50,Gecode::ICL_DOM);
      Random bnd_r(50,-500,500,Gecode::ICL_BND);
      Random val_r(50,-500,500,Gecode::ICL_VAL);
@@ -87,6 +87,44 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for detecting identical relations between integer variables
+     class IntVarIdentical : public Test {
+     protected:
+       /// Integer relation type to propagate
+       Gecode::IntRelType irt;
+     public:
+       /// Create and register test
+       IntVarIdentical(Gecode::IntRelType irt0, Gecode::IntConLevel icl)
+         : Test("Rel::Int::Var::Identical::"+str(irt0)+"::"+str(icl),
+                2,-3,3,false,icl),
+           irt(irt0) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         return cmp(x[0],irt,x[1]);
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         home.identical(true);
+         rel(home, x[0], irt, x[1], icl);
+         rel(home, x[0], irt, x[1], icl);
+         switch (irt) {
+         case IRT_LQ: rel(home, x[1], IRT_GQ, x[0], icl); break;
+         case IRT_LE: rel(home, x[1], IRT_GR, x[0], icl); break;
+         case IRT_GQ: rel(home, x[1], IRT_LQ, x[0], icl); break;
+         case IRT_GR: rel(home, x[1], IRT_LE, x[0], icl); break;
+         default: rel(home, x[1], irt, x[0], icl);
+         }
+         // Implied relations
+         if ((irt == IRT_LE) || (irt == IRT_GR))
+           rel(home, x[0], IRT_NQ, x[1], icl);
+         if (irt == IRT_LE)
+           rel(home, x[0], IRT_LQ, x[1], icl);
+         if (irt == IRT_GR)
+           rel(home, x[0], IRT_GQ, x[1], icl);
+       }
+     };
+
      /// %Test for simple relation involving shared integer variables
      class IntVarXX : public Test {
      protected:
@@ -522,6 +560,7 @@ namespace Test { namespace Int {
              (void) new IntVarXY(irts.irt(),1,icls.icl());
              (void) new IntVarXY(irts.irt(),2,icls.icl());
              (void) new IntVarXX(irts.irt(),icls.icl());
+             (void) new IntVarIdentical(irts.irt(),icls.icl());
              (void) new IntSeq(1,irts.irt(),icls.icl());
              (void) new IntSeq(2,irts.irt(),icls.icl());
              (void) new IntSeq(3,irts.irt(),icls.icl());
@@ -0,0 +1,169 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2013
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+#include <gecode/int.hh>
+
+#include "test/test.hh"
+
+namespace Test {
+
+  /// %Test for parallel propagation
+  class Propagation : public Test::Base {
+  protected:
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Integer variables
+      Gecode::IntVarArray x;
+      /// Constructor for creation with \a n variables and \a t threads
+      TestSpace(int n, unsigned int t) : x(*this,n,0,n_v-1) {
+        parallel(t);
+      }
+      /// Constructor for cloning \a s
+      TestSpace(bool share, TestSpace& s) : Space(share,s) {
+        x.update(*this,share,s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(bool share) {
+        return new TestSpace(share,*this);
+      }
+    };
+    /// How many groups of variables
+    static const int n_g = 12;
+    /// How many variables per group
+    static const int n_x = 10;
+    /// Number of values per variable
+    static const int n_v = 14;
+    /// How many random instances to test
+    static const int n_i = 32;
+    /// Post constraints for group \a g with coefficients \a a and right hand side \a c
+    static void group(TestSpace& s, int g, const Gecode::IntArgs& a, int c) {
+      using namespace Gecode;
+      IntVarArgs y(n_x);
+      for (int i=0; i<n_x; i++)
+        y[i] = s.x[g*n_x+i];
+      for (int i=0; i<n_x; i++)
+        for (int j=i+1; j<n_x; j++)
+          rel(s, y[i], IRT_NQ, y[j]);
+      linear(s, a, y, IRT_LQ, c);
+    }
+    /// Test whether \a s and \a t have the same variable domains
+    static bool same(TestSpace& s, TestSpace& t) {
+      using namespace Gecode;
+      for (int i=0; i<s.x.size(); i++) {
+        IntVarRanges r(s.x[i]), q(t.x[i]);
+        if (!Iter::Ranges::equal(r,q))
+          return false;
+      }
+      return true;
+    }
+    /// Test whether \a s and \a t agree after propagation
+    bool check(TestSpace& s, TestSpace& t) {
+      Gecode::SpaceStatus ss = s.status();
+      Gecode::SpaceStatus st = t.status();
+      if ((ss == Gecode::SS_FAILED) != (st == Gecode::SS_FAILED)) {
+        olog << ind(2) << "Failure differs" << std::endl;
+        return false;
+      }
+      if ((ss != Gecode::SS_FAILED) && !same(s,t)) {
+        olog << ind(2) << "Domains differ" << std::endl;
+        return false;
+      }
+      return true;
+    }
+  public:
+    /// Initialize test
+    Propagation(void) : Test::Base("Propagation::Parallel") {}
+    /// Perform actual tests
+    bool run(void) {
+      using namespace Gecode;
+      for (int i=n_i; i--; ) {
+        unsigned int t = 2 + rand(3);
+        TestSpace* s = new TestSpace(n_g*n_x,1);
+        TestSpace* p = new TestSpace(n_g*n_x,t);
+        for (int g=0; g<n_g; g++) {
+          IntArgs a(n_x);
+          for (int j=0; j<n_x; j++)
+            a[j] = 1 + static_cast<int>(rand(3));
+          int c = static_cast<int>(rand(n_x*n_v));
+          group(*s,g,a,c); group(*p,g,a,c);
+        }
+        // Connect some groups
+        for (int g=0; g<n_g; g++)
+          if (rand(4) == 0) {
+            int y = g*n_x + static_cast<int>(rand(n_x));
+            int z = static_cast<int>(rand(n_g*n_x));
+            rel(*s, s->x[y], IRT_LQ, s->x[z]);
+            rel(*p, p->x[y], IRT_LQ, p->x[z]);
+          }
+        // Schedule all propagators
+        for (int j=0; j<n_g*n_x; j++) {
+          int v = static_cast<int>(rand(n_v));
+          rel(*s, s->x[j], IRT_NQ, v); rel(*p, p->x[j], IRT_NQ, v);
+        }
+        if (!check(*s,*p)) {
+          delete s; delete p;
+          return false;
+        }
+        // Propagate clones after further pruning
+        if (!s->failed()) {
+          TestSpace* sc = static_cast<TestSpace*>(s->clone());
+          TestSpace* pc = static_cast<TestSpace*>(p->clone());
+          for (int j=0; j<n_g*n_x; j++)
+            if (rand(2) == 0) {
+              int v = static_cast<int>(rand(n_v));
+              rel(*sc, sc->x[j], IRT_NQ, v); rel(*pc, pc->x[j], IRT_NQ, v);
+            }
+          bool ok = check(*sc,*pc);
+          delete sc; delete pc;
+          if (!ok) {
+            delete s; delete p;
+            return false;
+          }
+        }
+        delete s; delete p;
+      }
+      return true;
+    }
+  };
+
+  Propagation propagation;
+
+}
+
+// STATISTICS: test-core
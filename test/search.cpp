@@ -335,6 +335,104 @@ namespace Test {
       }
     };
 
+    /// %Test for limited discrepancy search
+    template<class Model>
+    class LDS : public Test {
+    private:
+      /// Minimal recomputation distance
+      unsigned int c_d;
+      /// Adaptive recomputation distance
+      unsigned int a_d;
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      LDS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+        : Test("LDS::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
+               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.c_d = c_d;
+        o.a_d = a_d;
+        o.threads = t;
+        o.stop = &f;
+        Gecode::LDS<Model> lds(m,o);
+        int n = m->solutions();
+        delete m;
+        while (true) {
+          Model* s = lds.next();
+          if (s != NULL) {
+            n--; delete s;
+          }
+          if ((s == NULL) && !lds.stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        // Every solution must be found exactly once
+        return n == 0;
+      }
+    };
+
+    /// %Test for depth-first search with trailing
+    template<class Model>
+    class TrailDFS : public Test {
+    private:
+      /// Minimal recomputation distance
+      unsigned int c_d;
+      /// Adaptive recomputation distance
+      unsigned int a_d;
+      /// How to allocate memory chunks
+      Gecode::Heap::ChunkMode cm;
+    public:
+      /// Initialize test
+      TrailDFS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+               unsigned int c_d0, unsigned int a_d0,
+               Gecode::Heap::ChunkMode cm0)
+        : Test("DFS::Trail::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(c_d0)+"::"+str(a_d0)+"::"+
+               ((cm0 == Gecode::Heap::CM_MALLOC) ? "malloc" : "mmap"),
+               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), cm(cm0) {}
+      /// Run test
+      virtual bool run(void) {
+        Gecode::Heap::ChunkMode o_cm = Gecode::heap.chunk_mode();
+        Gecode::heap.chunk_mode(cm);
+        // Use memory chunks that can be write-protected
+        Gecode::MemoryOptions mo;
+        mo.hcsz_min = 4*1024;
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.c_d = c_d;
+        o.a_d = a_d;
+        o.trail = true;
+        o.memory = &mo;
+        o.stop = &f;
+        int n = m->solutions();
+        {
+          Gecode::DFS<Model> dfs(m,o);
+          delete m;
+          while (true) {
+            Model* s = dfs.next();
+            if (s != NULL) {
+              n--; delete s;
+            }
+            if ((s == NULL) && !dfs.stopped())
+              break;
+            f.limit(f.limit()+2);
+          }
+        }
+        Gecode::heap.chunk_mode(o_cm);
+        return n == 0;
+      }
+    };
+
     /// %Test for best solution search
     template<class Model, template<class> class Engine>
     class Best : public Test {
@@ -381,6 +479,57 @@ namespace Test {
       }
     };
 
+    /// %Test for portfolio search
+    template<class Model>
+    class Portfolio : public Test {
+    private:
+      /// Whether to search for best solutions
+      bool b;
+      /// Minimal recomputation distance
+      unsigned int c_d;
+      /// Adaptive recomputation distance
+      unsigned int a_d;
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      Portfolio(bool b0, HowToConstrain htc,
+                HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+                unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+        : Test(std::string("Portfolio::")+(b0 ? "BAB" : "DFS")+"::"+
+               Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
+               htb1,htb2,htb3,htc), b(b0), c_d(c_d0), a_d(a_d0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.c_d = c_d;
+        o.a_d = a_d;
+        o.threads = t;
+        o.stop = &f;
+        Gecode::Portfolio<Model> p(m,b,o);
+        int n = m->solutions();
+        delete m;
+        Model* l = NULL;
+        while (true) {
+          Model* s = p.next();
+          if (s != NULL) {
+            n--; delete l; l=s;
+          }
+          if ((s == NULL) && !p.stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        // All assets must agree on solutions or on the best solution
+        bool ok = b ? ((l == NULL) || l->best()) : (n == 0);
+        delete l;
+        return ok;
+      }
+    };
+
     /// Iterator for branching types
     class BranchTypes {
     private:
@@ -455,6 +604,38 @@ namespace Test {
                                     c_d, a_d, t);
             }
 
+        // Depth-first search with trailing
+        for (unsigned int c_d = 1; c_d<10; c_d++)
+          for (unsigned int a_d = 1; a_d<=c_d; a_d++) {
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3) {
+                  (void) new TrailDFS<HasSolutions>
+                    (htb1.htb(),htb2.htb(),htb3.htb(),c_d,a_d,
+                     Gecode::Heap::CM_MALLOC);
+                  (void) new TrailDFS<HasSolutions>
+                    (htb1.htb(),htb2.htb(),htb3.htb(),c_d,a_d,
+                     Gecode::Heap::CM_MMAP);
+                }
+            new TrailDFS<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE,
+                                        c_d, a_d, Gecode::Heap::CM_MALLOC);
+          }
+
+        // Limited discrepancy search
+        for (unsigned int t = 1; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<4; c_d++)
+            for (unsigned int a_d = 1; a_d<=c_d; a_d++) {
+              for (BranchTypes htb1; htb1(); ++htb1)
+                for (BranchTypes htb2; htb2(); ++htb2)
+                  for (BranchTypes htb3; htb3(); ++htb3)
+                    (void) new LDS<HasSolutions>(htb1.htb(),htb2.htb(),htb3.htb(),
+                                                 c_d, a_d, t);
+              new LDS<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE,
+                                     c_d, a_d, t);
+              new LDS<HasSolutions>(HTB_NONE, HTB_NONE, HTB_NONE,
+                                    c_d, a_d, t);
+            }
+
         // Best solution search
         for (unsigned int t = 1; t<=4; t++)
           for (unsigned int c_d = 1; c_d<10; c_d++)
@@ -475,6 +656,27 @@ namespace Test {
               (void) new Best<HasSolutions,BAB>
                 ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
             }
+
+        // Portfolio search
+        for (unsigned int t = 1; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<4; c_d++)
+            for (unsigned int a_d = 1; a_d<=c_d; a_d++) {
+              for (BranchTypes htb1; htb1(); ++htb1)
+                for (BranchTypes htb2; htb2(); ++htb2)
+                  for (BranchTypes htb3; htb3(); ++htb3) {
+                    (void) new Portfolio<HasSolutions>
+                      (false,HTC_NONE,htb1.htb(),htb2.htb(),htb3.htb(),
+                       c_d,a_d,t);
+                    for (ConstrainTypes htc; htc(); ++htc)
+                      (void) new Portfolio<HasSolutions>
+                        (true,htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
+                         c_d,a_d,t);
+                  }
+              (void) new Portfolio<FailImmediate>
+                (false,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
+              (void) new Portfolio<FailImmediate>
+                (true,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
+            }
         
       }
     };
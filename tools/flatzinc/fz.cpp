@@ -60,10 +60,14 @@ int main(int argc, char** argv) {
   
   FlatZinc::Printer p;
   FlatZinc::FlatZincSpace* fg = NULL;
+  if (opt.identical()) {
+    fg = new FlatZinc::FlatZincSpace();
+    fg->identical(true);
+  }
   if (!strcmp(filename, "-")) {
-    fg = FlatZinc::parse(cin, p);
+    fg = FlatZinc::parse(cin, p, std::cerr, fg);
   } else {
-    fg = FlatZinc::parse(filename, p);
+    fg = FlatZinc::parse(filename, p, std::cerr, fg);
   }
 
   if (fg) {